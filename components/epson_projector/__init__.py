@@ -1,31 +1,337 @@
+from esphome import automation
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import uart
-from esphome.const import CONF_ID, CONF_UPDATE_INTERVAL
+import esphome.final_validate as fv
+from esphome.components import uart, web_server_base
+from esphome.components.web_server_base import CONF_WEB_SERVER_BASE_ID
+from esphome.const import (
+    CONF_HOST,
+    CONF_ID,
+    CONF_NAME,
+    CONF_PATH,
+    CONF_PORT,
+    CONF_TRIGGER_ID,
+    CONF_UART_ID,
+    CONF_UPDATE_INTERVAL,
+)
 from esphome.core import CORE
+from esphome.helpers import cpp_string_escape
 
-from .const import CONF_MODEL
-from .models import get_model_names
+from .const import (
+    BRIGHTNESS_MAX,
+    BRIGHTNESS_MIN,
+    COLOR_TEMPERATURE_MAX,
+    COLOR_TEMPERATURE_MIN,
+    CONF_ASPECT_RATIO,
+    CONF_BRIDGE,
+    CONF_BRIGHTNESS,
+    CONF_COLOR_MODE,
+    CONF_COLOR_TEMPERATURE,
+    CONF_COMMAND_TAP,
+    CONF_CONTRAST,
+    CONF_DENSITY,
+    CONF_ERROR_CODE,
+    CONF_FREEZE,
+    CONF_GAMMA,
+    CONF_H_KEYSTONE,
+    CONF_H_REVERSE,
+    CONF_LAMP_HOURS,
+    CONF_LINK_DOWN_THRESHOLD,
+    CONF_LOOP_BUDGET,
+    CONF_LUMINANCE,
+    CONF_MAX_CACHE_AGE,
+    CONF_MODEL,
+    CONF_MUTE,
+    CONF_ON_SCENE_APPLIED,
+    CONF_PASSIVE,
+    CONF_POWER,
+    CONF_POWER_STATE,
+    CONF_RESTORE_STATE,
+    CONF_RX_BYTES_PER_LOOP,
+    CONF_SCENE,
+    CONF_SCENES,
+    CONF_SERIAL_NUMBER,
+    CONF_SHARPNESS,
+    CONF_SNAPSHOT,
+    CONF_SOURCE,
+    CONF_TINT,
+    CONF_TRANSPORT,
+    CONF_TRANSPORT_ID,
+    CONF_V_KEYSTONE,
+    CONF_V_REVERSE,
+    CONF_VOLUME,
+    CONF_WIRE_TRACE_SIZE,
+    CONTRAST_MAX,
+    CONTRAST_MIN,
+    DENSITY_MAX,
+    DENSITY_MIN,
+    ESCVP_NET_PORT,
+    SHARPNESS_MAX,
+    SHARPNESS_MIN,
+    TINT_MAX,
+    TINT_MIN,
+    TRANSPORT_TCP,
+    TRANSPORT_UART,
+)
+from .models import (
+    get_color_modes_for_model,
+    get_gamma_options_for_model,
+    get_luminance_options_for_model,
+    get_model,
+    get_common_unsupported_features,
+    get_model_names,
+    get_unsupported_features,
+)
 
 CODEOWNERS = ["@brothware"]
-DEPENDENCIES = ["uart"]
+MULTI_CONF = True
+
+
+def AUTO_LOAD():
+    # Runs before validation, so it reads the raw config. UART-only builds do not need the socket component.
+    hubs = (CORE.raw_config or {}).get("epson_projector") or []
+    if isinstance(hubs, dict):
+        hubs = [hubs]
+    for hub in hubs:
+        if not isinstance(hub, dict):
+            continue
+        if str(hub.get(CONF_TRANSPORT, TRANSPORT_UART)).lower() == TRANSPORT_TCP or CONF_BRIDGE in hub:
+            return ["socket"]
+    return []
+
 
 epson_projector_ns = cg.esphome_ns.namespace("epson_projector")
-EpsonProjector = epson_projector_ns.class_("EpsonProjector", uart.UARTDevice, cg.PollingComponent)
+EpsonProjector = epson_projector_ns.class_("EpsonProjector", cg.PollingComponent)
+Transport = epson_projector_ns.class_("Transport")
+UartTransport = epson_projector_ns.class_("UartTransport", Transport, uart.UARTDevice)
+TcpTransport = epson_projector_ns.class_("TcpTransport", Transport)
+PictureScene = epson_projector_ns.struct("PictureScene")
+ApplySceneAction = epson_projector_ns.class_("ApplySceneAction", automation.Action)
+DumpWireTraceAction = epson_projector_ns.class_("DumpWireTraceAction", automation.Action)
+SnapshotHandler = epson_projector_ns.class_("SnapshotHandler", cg.Component)
+BridgeServer = epson_projector_ns.class_("BridgeServer", cg.Component)
+SceneAppliedTrigger = epson_projector_ns.class_(
+    "SceneAppliedTrigger", automation.Trigger.template(cg.std_string, cg.bool_)
+)
 
-CONFIG_SCHEMA = (
-    cv.Schema(
+FEATURE_QUERIES = {
+    "mute": "MUTE",
+    "volume": "VOLUME",
+    "brightness": "BRIGHTNESS",
+    "contrast": "CONTRAST",
+    "color_modes": "COLOR_MODE",
+    "aspect_ratios": "ASPECT_RATIO",
+    "keystone_vertical": "V_KEYSTONE",
+    "keystone_horizontal": "H_KEYSTONE",
+    "luminance": "LUMINANCE",
+    "gamma": "GAMMA",
+}
+
+# Query behind each entity key, per platform. Queries no entity or scene uses are compiled out.
+ENTITY_QUERIES = {
+    "switch": {
+        CONF_POWER: "POWER",
+        CONF_MUTE: "MUTE",
+        CONF_H_REVERSE: "H_REVERSE",
+        CONF_V_REVERSE: "V_REVERSE",
+        CONF_FREEZE: "FREEZE",
+    },
+    "binary_sensor": {CONF_POWER_STATE: "POWER", CONF_MUTE: "MUTE"},
+    "sensor": {CONF_LAMP_HOURS: "LAMP_HOURS", CONF_ERROR_CODE: "ERROR_CODE"},
+    "text_sensor": {CONF_SERIAL_NUMBER: "SERIAL_NUMBER"},
+    "select": {
+        CONF_SOURCE: "SOURCE",
+        CONF_COLOR_MODE: "COLOR_MODE",
+        CONF_ASPECT_RATIO: "ASPECT_RATIO",
+        CONF_LUMINANCE: "LUMINANCE",
+        CONF_GAMMA: "GAMMA",
+    },
+    "number": {
+        CONF_VOLUME: "VOLUME",
+        CONF_BRIGHTNESS: "BRIGHTNESS",
+        CONF_CONTRAST: "CONTRAST",
+        CONF_SHARPNESS: "SHARPNESS",
+        CONF_DENSITY: "DENSITY",
+        CONF_TINT: "TINT",
+        CONF_COLOR_TEMPERATURE: "COLOR_TEMP",
+        CONF_V_KEYSTONE: "V_KEYSTONE",
+        CONF_H_KEYSTONE: "H_KEYSTONE",
+    },
+}
+
+SCENE_QUERIES = {
+    CONF_COLOR_MODE: "COLOR_MODE",
+    CONF_LUMINANCE: "LUMINANCE",
+    CONF_GAMMA: "GAMMA",
+    CONF_BRIGHTNESS: "BRIGHTNESS",
+    CONF_CONTRAST: "CONTRAST",
+    CONF_SHARPNESS: "SHARPNESS",
+    CONF_DENSITY: "DENSITY",
+    CONF_TINT: "TINT",
+    CONF_COLOR_TEMPERATURE: "COLOR_TEMP",
+}
+
+SCENE_OPTION_LOOKUPS = {
+    CONF_COLOR_MODE: get_color_modes_for_model,
+    CONF_LUMINANCE: get_luminance_options_for_model,
+    CONF_GAMMA: get_gamma_options_for_model,
+}
+
+SCENE_FIELDS = {
+    CONF_COLOR_MODE: "color_mode",
+    CONF_LUMINANCE: "luminance",
+    CONF_GAMMA: "gamma",
+    CONF_BRIGHTNESS: "brightness",
+    CONF_CONTRAST: "contrast",
+    CONF_SHARPNESS: "sharpness",
+    CONF_DENSITY: "density",
+    CONF_TINT: "tint",
+    CONF_COLOR_TEMPERATURE: "color_temp",
+}
+
+SCENE_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_NAME): cv.string_strict,
+        cv.Optional(CONF_COLOR_MODE): cv.string,
+        cv.Optional(CONF_LUMINANCE): cv.string,
+        cv.Optional(CONF_GAMMA): cv.string,
+        cv.Optional(CONF_BRIGHTNESS): cv.int_range(min=BRIGHTNESS_MIN, max=BRIGHTNESS_MAX),
+        cv.Optional(CONF_CONTRAST): cv.int_range(min=CONTRAST_MIN, max=CONTRAST_MAX),
+        cv.Optional(CONF_SHARPNESS): cv.int_range(min=SHARPNESS_MIN, max=SHARPNESS_MAX),
+        cv.Optional(CONF_DENSITY): cv.int_range(min=DENSITY_MIN, max=DENSITY_MAX),
+        cv.Optional(CONF_TINT): cv.int_range(min=TINT_MIN, max=TINT_MAX),
+        cv.Optional(CONF_COLOR_TEMPERATURE): cv.int_range(min=COLOR_TEMPERATURE_MIN, max=COLOR_TEMPERATURE_MAX),
+    }
+)
+
+
+def _validate_snapshot_path(value):
+    value = cv.string_strict(value)
+    if not value.startswith("/"):
+        raise cv.Invalid("Snapshot path must start with '/'")
+    return value
+
+
+SNAPSHOT_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(SnapshotHandler),
+        cv.GenerateID(CONF_WEB_SERVER_BASE_ID): cv.use_id(web_server_base.WebServerBase),
+        cv.Optional(CONF_PATH, default="/epson_projector"): _validate_snapshot_path,
+    }
+)
+
+
+BRIDGE_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(BridgeServer),
+        cv.Required(CONF_PORT): cv.port,
+        cv.Optional(CONF_MAX_CACHE_AGE, default="5s"): cv.positive_time_period_milliseconds,
+    }
+)
+
+
+# Receive-only UART on the line from the other controller to the projector.
+COMMAND_TAP_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(UartTransport),
+        cv.Required(CONF_UART_ID): cv.use_id(uart.UARTComponent),
+    }
+)
+
+
+def _validate_passive(config):
+    if CONF_COMMAND_TAP in config and not config[CONF_PASSIVE]:
+        raise cv.Invalid("command_tap only applies in passive mode", path=[CONF_COMMAND_TAP])
+    return config
+
+
+BASE_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(EpsonProjector),
+        cv.Required(CONF_MODEL): cv.one_of(*get_model_names(), lower=True),
+        cv.Optional(CONF_UPDATE_INTERVAL, default="5s"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_LINK_DOWN_THRESHOLD, default=3): cv.int_range(min=1, max=20),
+        cv.Optional(CONF_RESTORE_STATE, default=True): cv.boolean,
+        cv.Optional(CONF_WIRE_TRACE_SIZE, default=0): cv.int_range(min=0, max=128),
+        cv.Optional(CONF_SNAPSHOT): SNAPSHOT_SCHEMA,
+        cv.Optional(CONF_BRIDGE): BRIDGE_SCHEMA,
+        cv.Optional(CONF_LOOP_BUDGET, default="2ms"): cv.positive_time_period_microseconds,
+        cv.Optional(CONF_RX_BYTES_PER_LOOP, default=64): cv.int_range(min=1, max=1024),
+        cv.Optional(CONF_SCENES, default=[]): cv.ensure_list(SCENE_SCHEMA),
+        cv.Optional(CONF_ON_SCENE_APPLIED): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(SceneAppliedTrigger),
+            }
+        ),
+    }
+).extend(cv.polling_component_schema("5s"))
+
+
+def _validate_scenes(config):
+    names = [scene[CONF_NAME] for scene in config[CONF_SCENES]]
+    for name in names:
+        if names.count(name) > 1:
+            raise cv.Invalid(f"Duplicate scene name '{name}'", path=[CONF_SCENES])
+
+    model_id = config[CONF_MODEL]
+    for index, scene in enumerate(config[CONF_SCENES]):
+        for key, lookup in SCENE_OPTION_LOOKUPS.items():
+            if key not in scene:
+                continue
+            options = lookup(model_id)
+            if scene[key] not in options:
+                raise cv.Invalid(
+                    f"Unknown {key} '{scene[key]}' for model {model_id}, expected one of: {', '.join(options)}",
+                    path=[CONF_SCENES, index, key],
+                )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.typed_schema(
         {
-            cv.GenerateID(): cv.declare_id(EpsonProjector),
-            cv.Required(CONF_MODEL): cv.one_of(*get_model_names(), lower=True),
-            cv.Optional(CONF_UPDATE_INTERVAL, default="5s"): cv.positive_time_period_milliseconds,
-        }
-    )
-    .extend(uart.UART_DEVICE_SCHEMA)
-    .extend(cv.polling_component_schema("5s"))
+            TRANSPORT_UART: cv.All(
+                BASE_SCHEMA.extend(
+                    {
+                        cv.GenerateID(CONF_TRANSPORT_ID): cv.declare_id(UartTransport),
+                        cv.Optional(CONF_PASSIVE, default=False): cv.boolean,
+                        cv.Optional(CONF_COMMAND_TAP): COMMAND_TAP_SCHEMA,
+                    }
+                ).extend(uart.UART_DEVICE_SCHEMA),
+                _validate_passive,
+            ),
+            TRANSPORT_TCP: BASE_SCHEMA.extend(
+                {
+                    cv.GenerateID(CONF_TRANSPORT_ID): cv.declare_id(TcpTransport),
+                    cv.Required(CONF_HOST): cv.domain,
+                    cv.Optional(CONF_PORT, default=ESCVP_NET_PORT): cv.port,
+                }
+            ),
+        },
+        key=CONF_TRANSPORT,
+        default_type=TRANSPORT_UART,
+        lower=True,
+    ),
+    _validate_scenes,
 )
 
 
+def _validate_unique_snapshot_path(config):
+    if (snapshot := config.get(CONF_SNAPSHOT)) is None:
+        return config
+    hubs = fv.full_config.get().get("epson_projector", [])
+    paths = [hub[CONF_SNAPSHOT][CONF_PATH] for hub in hubs if CONF_SNAPSHOT in hub]
+    if paths.count(snapshot[CONF_PATH]) > 1:
+        raise cv.Invalid(
+            f"Snapshot path '{snapshot[CONF_PATH]}' is used by more than one hub, give each hub its own path",
+            path=[CONF_SNAPSHOT, CONF_PATH],
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _validate_unique_snapshot_path
+
+
 def _filter_platform_sources() -> list[str]:
     platform_files = {
         "number": ["epson_number.cpp", "epson_number.h"],
@@ -35,18 +341,161 @@ def _filter_platform_sources() -> list[str]:
         "switch": ["epson_switch.cpp", "epson_switch.h"],
         "text_sensor": ["epson_text_sensor.cpp", "epson_text_sensor.h"],
     }
+    transport_files = {
+        TRANSPORT_UART: ["uart_transport.cpp", "uart_transport.h"],
+        TRANSPORT_TCP: ["tcp_transport.cpp", "tcp_transport.h", "escvp_net.cpp", "escvp_net.h"],
+    }
 
     excluded = []
+    if not any(CONF_SNAPSHOT in hub_config for hub_config in _hub_configs()):
+        excluded.extend(["snapshot_handler.cpp", "snapshot_handler.h"])
+    if not any(CONF_BRIDGE in hub_config for hub_config in _hub_configs()):
+        excluded.extend(["bridge_server.cpp", "bridge_server.h"])
     for platform, files in platform_files.items():
         if platform not in CORE.config:
             excluded.extend(files)
+
+    transports = _configured_transports()
+    for name, files in transport_files.items():
+        if name not in transports:
+            excluded.extend(files)
     return excluded
 
 
+def _hub_configs() -> list[dict]:
+    return CORE.config.get("epson_projector", [])
+
+
+def _configured_transports() -> set[str]:
+    return {TRANSPORT_TCP if CONF_HOST in hub_config else TRANSPORT_UART for hub_config in _hub_configs()}
+
+
 FILTER_SOURCE_FILES = _filter_platform_sources
 
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
-    await uart.register_uart_device(var, config)
+    cg.add(var.set_link_down_threshold(config[CONF_LINK_DOWN_THRESHOLD]))
+    cg.add(var.set_restore_state(config[CONF_RESTORE_STATE]))
+    cg.add(var.set_state_key(str(config[CONF_ID].id)))
+    cg.add(var.set_loop_budget(config[CONF_LOOP_BUDGET]))
+    cg.add(var.set_rx_bytes_per_loop(config[CONF_RX_BYTES_PER_LOOP]))
+
+    transport = cg.new_Pvariable(config[CONF_TRANSPORT_ID])
+    if CONF_HOST in config:
+        cg.add(transport.set_host(str(config[CONF_HOST])))
+        cg.add(transport.set_port(config[CONF_PORT]))
+    else:
+        await uart.register_uart_device(transport, config)
+    cg.add(var.set_transport(transport))
+
+    if config.get(CONF_PASSIVE):
+        cg.add(var.set_passive(True))
+        if tap_config := config.get(CONF_COMMAND_TAP):
+            tap = cg.new_Pvariable(tap_config[CONF_ID])
+            await uart.register_uart_device(tap, tap_config)
+            cg.add(var.set_command_tap(tap))
+
+    model_ids = [hub_config[CONF_MODEL] for hub_config in _hub_configs()]
+    _add_model_defines(model_ids)
+    cg.add_define("EPSON_PROJECTOR_USED_QUERIES", _query_bits(sorted(_used_queries())))
+    if len(set(model_ids)) > 1:
+        model_id = config[CONF_MODEL]
+        cg.add(var.set_model(get_model(model_id)["name"], _query_mask(get_unsupported_features(model_id))))
+    trace_size = max(hub_config[CONF_WIRE_TRACE_SIZE] for hub_config in _hub_configs())
+    if trace_size > 0:
+        cg.add_define("USE_EPSON_PROJECTOR_WIRE_TRACE", trace_size)
+
+    if snapshot := config.get(CONF_SNAPSHOT):
+        base = await cg.get_variable(snapshot[CONF_WEB_SERVER_BASE_ID])
+        handler = cg.new_Pvariable(snapshot[CONF_ID], base, var, snapshot[CONF_PATH])
+        await cg.register_component(handler, snapshot)
+
+    if bridge := config.get(CONF_BRIDGE):
+        server = cg.new_Pvariable(bridge[CONF_ID], var, bridge[CONF_PORT], bridge[CONF_MAX_CACHE_AGE])
+        await cg.register_component(server, bridge)
+
+    for scene in config[CONF_SCENES]:
+        await _add_scene(var, config[CONF_MODEL], scene)
+
+    for conf in config.get(CONF_ON_SCENE_APPLIED, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(trigger, [(cg.std_string, "scene"), (bool, "success")], conf)
+
+
+def _query_mask(features):
+    return _query_bits(FEATURE_QUERIES[feature] for feature in features)
+
+
+def _query_bits(queries):
+    ns = "esphome::epson_projector::"
+    mask = " | ".join(f"{ns}query_bit({ns}QueryType::{query})" for query in queries)
+    return cg.RawExpression(f"({mask})" if mask else "0")
+
+
+def _used_queries() -> set[str]:
+    used = {"POWER"}
+    for platform, queries in ENTITY_QUERIES.items():
+        for platform_config in CORE.config.get(platform, []):
+            if platform_config.get("platform") == "epson_projector":
+                used.update(query for key, query in queries.items() if key in platform_config)
+    for hub_config in _hub_configs():
+        for scene in hub_config[CONF_SCENES]:
+            used.update(query for key, query in SCENE_QUERIES.items() if key in scene)
+    return used
+
+
+def _add_model_defines(model_ids):
+    # Queries no configured model supports are compiled out; per-instance masks cover the rest.
+    if len(set(model_ids)) == 1:
+        name = get_model(model_ids[0])["name"]
+        cg.add_define("EPSON_PROJECTOR_MODEL_NAME", cg.RawExpression(cpp_string_escape(name)))
+    unsupported = get_common_unsupported_features(model_ids)
+    if unsupported:
+        cg.add_define("EPSON_PROJECTOR_UNSUPPORTED_QUERIES", _query_mask(unsupported))
+
+
+async def _add_scene(var, model_id, scene):
+    fields = [("name", scene[CONF_NAME])]
+    for key, field in SCENE_FIELDS.items():
+        if key not in scene:
+            continue
+        value = scene[key]
+        if key in SCENE_OPTION_LOOKUPS:
+            value = SCENE_OPTION_LOOKUPS[key](model_id)[value]
+        fields.append((field, value))
+    cg.add(var.add_scene(cg.StructInitializer(PictureScene, *fields)))
+
+
+@automation.register_action(
+    "epson_projector.apply_scene",
+    ApplySceneAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(EpsonProjector),
+            cv.Required(CONF_SCENE): cv.templatable(cv.string),
+        }
+    ),
+)
+async def apply_scene_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_SCENE], args, cg.std_string)
+    cg.add(var.set_scene(template_))
+    return var
+
+
+@automation.register_action(
+    "epson_projector.dump_wire_trace",
+    DumpWireTraceAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(EpsonProjector),
+        }
+    ),
+)
+async def dump_wire_trace_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
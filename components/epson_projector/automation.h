@@ -0,0 +1,34 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+
+#include "entity_base.h"
+#include "epson_projector.h"
+
+#include <string>
+
+namespace esphome::epson_projector {
+
+template <typename... Ts>
+class ApplySceneAction : public Action<Ts...>, public Parented<EpsonProjector> {
+ public:
+  TEMPLATABLE_VALUE(std::string, scene)
+
+  void play(Ts... x) override { this->parent_->apply_scene(this->scene_.value(x...)); }
+};
+
+template <typename... Ts>
+class DumpWireTraceAction : public Action<Ts...>, public Parented<EpsonProjector> {
+ public:
+  void play(Ts... x) override { this->parent_->dump_wire_trace(); }
+};
+
+class SceneAppliedTrigger : public Trigger<std::string, bool> {
+ public:
+  explicit SceneAppliedTrigger(EpsonProjector *parent) {
+    parent->add_on_scene_applied_callback(
+        [this](const std::string &scene, bool success) { this->trigger(scene, success); });
+  }
+};
+
+}  // namespace esphome::epson_projector
@@ -1,11 +1,11 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import binary_sensor
-from esphome.const import DEVICE_CLASS_POWER, ENTITY_CATEGORY_DIAGNOSTIC
+from esphome.const import DEVICE_CLASS_CONNECTIVITY, DEVICE_CLASS_POWER, ENTITY_CATEGORY_DIAGNOSTIC
 
 from . import _filter_platform_sources, epson_projector_ns
-from .const import CONF_MUTE, CONF_POWER_STATE, ICON_MUTE, ICON_PROJECTOR
-from .platform_helpers import get_projector_parent, projector_platform_schema
+from .const import CONF_LINK_STATE, CONF_MUTE, CONF_POWER_STATE, ICON_LINK, ICON_MUTE, ICON_PROJECTOR
+from .platform_helpers import get_projector_parent, projector_platform_schema, validate_model_features
 
 DEPENDENCIES = ["epson_projector"]
 FILTER_SOURCE_FILES = _filter_platform_sources
@@ -16,31 +16,39 @@ BinarySensorType = epson_projector_ns.enum("BinarySensorType", is_class=True)
 SENSOR_TYPES = {
     CONF_POWER_STATE: BinarySensorType.POWER_STATE,
     CONF_MUTE: BinarySensorType.MUTE_STATE,
+    CONF_LINK_STATE: BinarySensorType.LINK_STATE,
 }
 
 CONFIG_SCHEMA = projector_platform_schema(
     {
         cv.Optional(CONF_POWER_STATE): binary_sensor.binary_sensor_schema(
-            EpsonBinarySensor,
+            EpsonBinarySensor.template(SENSOR_TYPES[CONF_POWER_STATE]),
             device_class=DEVICE_CLASS_POWER,
             icon=ICON_PROJECTOR,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
         cv.Optional(CONF_MUTE): binary_sensor.binary_sensor_schema(
-            EpsonBinarySensor,
+            EpsonBinarySensor.template(SENSOR_TYPES[CONF_MUTE]),
             icon=ICON_MUTE,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
+        cv.Optional(CONF_LINK_STATE): binary_sensor.binary_sensor_schema(
+            EpsonBinarySensor.template(SENSOR_TYPES[CONF_LINK_STATE]),
+            device_class=DEVICE_CLASS_CONNECTIVITY,
+            icon=ICON_LINK,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
     }
 )
 
 
+FINAL_VALIDATE_SCHEMA = validate_model_features("binary_sensor")
+
 async def to_code(config):
     parent = await get_projector_parent(config)
 
-    for key, sensor_type in SENSOR_TYPES.items():
+    for key in SENSOR_TYPES:
         if conf := config.get(key):
             sens = await binary_sensor.new_binary_sensor(conf)
             await cg.register_component(sens, conf)
             cg.add(sens.set_parent(parent))
-            cg.add(sens.set_sensor_type(sensor_type))
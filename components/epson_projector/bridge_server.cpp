@@ -0,0 +1,194 @@
+#include "bridge_server.h"
+
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace esphome::epson_projector {
+
+static const char *const TAG = "epson_projector.bridge";
+
+namespace {
+
+// What the projector sends for a command it rejects.
+const char *const ERROR_REPLY = "ERR\r:";
+
+bool is_would_block(int err) { return err == EAGAIN || err == EWOULDBLOCK; }
+
+}  // namespace
+
+void BridgeServer::setup() {
+  this->listener_ = socket::socket_ip(SOCK_STREAM, 0);
+  if (this->listener_ == nullptr) {
+    ESP_LOGE(TAG, "Could not create bridge socket");
+    this->mark_failed();
+    return;
+  }
+  int enable = 1;
+  this->listener_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+  this->listener_->setblocking(false);
+
+  struct sockaddr_storage addr {};
+  socklen_t addr_len =
+      socket::set_sockaddr_any(reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr), this->port_);
+  if (addr_len == 0 || this->listener_->bind(reinterpret_cast<struct sockaddr *>(&addr), addr_len) != 0 ||
+      this->listener_->listen(MAX_CLIENTS) != 0) {
+    ESP_LOGE(TAG, "Could not listen on port %u: %s", this->port_, strerror(errno));
+    this->listener_.reset();
+    this->mark_failed();
+    return;
+  }
+  if (this->port_ == 0) {
+    // Port 0 lets the system pick one; sin_port and sin6_port share the same offset.
+    this->listener_->getsockname(reinterpret_cast<struct sockaddr *>(&addr), &addr_len);
+    this->port_ = ntohs(reinterpret_cast<struct sockaddr_in *>(&addr)->sin_port);
+  }
+}
+
+void BridgeServer::loop() {
+  if (this->listener_ == nullptr) {
+    return;
+  }
+  this->accept_clients();
+  // One command per client per pass, starting with a different client each time.
+  for (size_t i = 0; i < MAX_CLIENTS; i++) {
+    this->serve((this->next_client_ + i) % MAX_CLIENTS);
+  }
+  this->next_client_ = (this->next_client_ + 1) % MAX_CLIENTS;
+}
+
+void BridgeServer::dump_config() {
+  auto connected = std::ranges::count_if(this->clients_, [](const Client &client) { return client.socket != nullptr; });
+  ESP_LOGCONFIG(TAG, "Epson Projector Bridge:");
+  ESP_LOGCONFIG(TAG, "  Port: %u", this->port_);
+  ESP_LOGCONFIG(TAG, "  Max Cache Age: %u ms", this->max_cache_age_ms_);
+  ESP_LOGCONFIG(TAG, "  Clients: %u of %u", static_cast<unsigned>(connected), static_cast<unsigned>(MAX_CLIENTS));
+  ESP_LOGCONFIG(TAG, "  Answered from cache: %u, forwarded: %u", this->cache_hits_, this->forwarded_);
+}
+
+void BridgeServer::on_shutdown() {
+  for (Client &client : this->clients_) {
+    if (client.socket != nullptr) {
+      this->disconnect(client, "shutting down");
+    }
+  }
+  if (this->listener_ != nullptr) {
+    this->listener_->close();
+    this->listener_.reset();
+  }
+}
+
+void BridgeServer::accept_clients() {
+  while (true) {
+    struct sockaddr_storage addr {};
+    socklen_t addr_len = sizeof(addr);
+    auto socket = this->listener_->accept(reinterpret_cast<struct sockaddr *>(&addr), &addr_len);
+    if (socket == nullptr) {
+      return;
+    }
+    auto slot = std::ranges::find_if(this->clients_, [](const Client &client) { return client.socket == nullptr; });
+    if (slot == this->clients_.end()) {
+      ESP_LOGW(TAG, "Refusing client, %u already connected", static_cast<unsigned>(MAX_CLIENTS));
+      socket->close();
+      continue;
+    }
+    socket->setblocking(false);
+    int enable = 1;
+    socket->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    slot->socket = std::move(socket);
+    slot->tap.clear();
+    slot->rx_head = 0;
+    slot->rx_len = 0;
+    slot->tx_buf.clear();
+    slot->busy = false;
+    slot->generation++;
+    ESP_LOGD(TAG, "Client connected");
+  }
+}
+
+bool BridgeServer::read_command(Client &client) {
+  if (client.rx_head == client.rx_len) {
+    ssize_t n = client.socket->read(client.rx_buf, sizeof(client.rx_buf));
+    if (n <= 0) {
+      if (n == 0 || !is_would_block(errno)) {
+        this->disconnect(client, n == 0 ? "closed by client" : strerror(errno));
+      }
+      return false;
+    }
+    client.rx_head = 0;
+    client.rx_len = n;
+  }
+  while (client.rx_head < client.rx_len) {
+    if (client.tap.push(client.rx_buf[client.rx_head++])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void BridgeServer::serve(size_t index) {
+  Client &client = this->clients_[index];
+  if (client.socket == nullptr || client.busy || !this->flush(client) || !this->read_command(client)) {
+    return;
+  }
+  uint8_t generation = client.generation;
+  const std::string &line = client.tap.line();
+  auto command = parse_observed_command(line);
+  if (!command) {
+    // A bare CR asks for the prompt, which is what the projector would send.
+    this->send_reply(index, generation, std::string(1, RESPONSE_PROMPT));
+    return;
+  }
+  const QueryInfo *info = command->is_query ? find_query_info(command->key) : nullptr;
+  if (info != nullptr && this->parent_->cached_reply(info->type, this->max_cache_age_ms_, this->reply_)) {
+    ESP_LOGV(TAG, "%s? answered from cache", info->cmd);
+    this->cache_hits_++;
+    this->send_reply(index, generation, this->reply_);
+    return;
+  }
+  client.busy = true;
+  this->forwarded_++;
+  this->parent_->forward(line, [this, index, generation](bool, const std::string &response) {
+    // Timeouts and cancelled commands have no reply of their own; the client still needs one to move on.
+    this->send_reply(index, generation, response.empty() ? std::string(ERROR_REPLY) : response);
+  });
+}
+
+void BridgeServer::send_reply(size_t index, uint8_t generation, const std::string &reply) {
+  Client &client = this->clients_[index];
+  if (client.socket == nullptr || client.generation != generation) {
+    return;
+  }
+  client.busy = false;
+  client.tx_buf += reply;
+  this->flush(client);
+}
+
+// Returns true once everything queued for the client has been written.
+bool BridgeServer::flush(Client &client) {
+  if (client.tx_buf.empty()) {
+    return true;
+  }
+  ssize_t written = client.socket->write(client.tx_buf.data(), client.tx_buf.size());
+  if (written < 0) {
+    if (!is_would_block(errno)) {
+      this->disconnect(client, strerror(errno));
+    }
+    return false;
+  }
+  client.tx_buf.erase(0, written);
+  return client.tx_buf.empty();
+}
+
+void BridgeServer::disconnect(Client &client, const char *reason) {
+  ESP_LOGD(TAG, "Client disconnected: %s", reason);
+  client.socket->close();
+  client.socket.reset();
+  client.tx_buf.clear();
+  client.generation++;
+  client.busy = false;
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "esphome/components/socket/socket.h"
+#include "esphome/core/component.h"
+
+#include "command_tap.h"
+#include "epson_projector.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace esphome::epson_projector {
+
+// Lets control software on the LAN speak raw ESC/VP21 over TCP while the hub keeps polling. Each client
+// has at most one command in the hub's queue and clients are admitted round-robin, so no client can
+// starve the others or the local entities. Fresh cached values answer "KEY?" without using the wire.
+class BridgeServer : public Component {
+ public:
+  BridgeServer(EpsonProjector *parent, uint16_t port, uint32_t max_cache_age_ms)
+      : parent_(parent), port_(port), max_cache_age_ms_(max_cache_age_ms) {}
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  void on_shutdown() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+
+  [[nodiscard]] uint16_t port() const { return this->port_; }
+  [[nodiscard]] uint32_t cache_hits() const { return this->cache_hits_; }
+  [[nodiscard]] uint32_t forwarded() const { return this->forwarded_; }
+
+  static constexpr size_t MAX_CLIENTS = 4;
+
+ protected:
+  struct Client {
+    std::unique_ptr<socket::Socket> socket;
+    CommandTap tap;
+    uint8_t rx_buf[64]{};
+    size_t rx_head{0};
+    size_t rx_len{0};
+    // Reply bytes the socket has not taken yet; the client's next command waits until they are out.
+    std::string tx_buf;
+    // Bumped on every connect and disconnect so a late reply never reaches the next client in the slot.
+    uint8_t generation{0};
+    bool busy{false};
+  };
+
+  void accept_clients();
+  bool read_command(Client &client);
+  bool flush(Client &client);
+  void serve(size_t index);
+  void send_reply(size_t index, uint8_t generation, const std::string &reply);
+  void disconnect(Client &client, const char *reason);
+
+  EpsonProjector *parent_;
+  uint16_t port_;
+  uint32_t max_cache_age_ms_;
+  std::unique_ptr<socket::Socket> listener_;
+  std::array<Client, MAX_CLIENTS> clients_{};
+  size_t next_client_{0};
+  std::string reply_;
+  uint32_t cache_hits_{0};
+  uint32_t forwarded_{0};
+};
+
+}  // namespace esphome::epson_projector
@@ -9,7 +9,7 @@
 
 namespace esphome::epson_projector {
 
-std::string sanitize_value(const std::string &value) {
+std::string sanitize_value(std::string_view value) {
   std::string result;
   result.reserve(value.size());
   std::ranges::copy_if(value, std::back_inserter(result), [](char c) {
@@ -18,7 +18,7 @@ std::string sanitize_value(const std::string &value) {
   return result;
 }
 
-bool is_valid_source_code(const std::string &code) {
+bool is_valid_source_code(std::string_view code) {
   if (code.empty() || code.size() > 4) {
     return false;
   }
@@ -36,7 +36,7 @@ std::string build_query_command(const char *cmd) {
   return result;
 }
 
-std::string build_set_command(const char *cmd, const char *value) {
+std::string build_set_command(const char *cmd, std::string_view value) {
   std::string sanitized = sanitize_value(value);
   if (sanitized.empty()) {
     return {};
@@ -49,7 +49,7 @@ std::string build_set_command(const char *cmd, const char *value) {
 }
 
 std::string build_set_command(const char *cmd, int value) {
-  return build_set_command(cmd, std::to_string(value).c_str());
+  return build_set_command(cmd, std::to_string(value));
 }
 
 std::string build_power_on_command() {
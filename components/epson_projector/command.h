@@ -1,8 +1,11 @@
 #pragma once
 
+#include "query_metadata.h"
+
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 
 namespace esphome::epson_projector {
 
@@ -16,15 +19,16 @@ struct Command {
   CommandType type;
   std::function<void(bool success, const std::string &response)> callback;
   uint8_t retry_count{0};
+  const QueryInfo *info{nullptr};
   static constexpr uint8_t MAX_RETRIES = 3;
 };
 
-std::string sanitize_value(const std::string &value);
-bool is_valid_source_code(const std::string &code);
+std::string sanitize_value(std::string_view value);
+bool is_valid_source_code(std::string_view code);
 int clamp_value(int value, int min_val, int max_val);
 
 std::string build_query_command(const char *cmd);
-std::string build_set_command(const char *cmd, const char *value);
+std::string build_set_command(const char *cmd, std::string_view value);
 std::string build_set_command(const char *cmd, int value);
 std::string build_power_on_command();
 std::string build_power_off_command();
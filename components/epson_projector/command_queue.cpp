@@ -1,5 +1,8 @@
 #include "command_queue.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace esphome::epson_projector {
 
 void CommandQueue::enqueue(Command cmd) {
@@ -29,9 +32,32 @@ size_t CommandQueue::size() const {
 
 void CommandQueue::clear() {
   queue_.clear();
+  deferred_.clear();
   pending_command_.reset();
 }
 
+size_t CommandQueue::cancel_if(const std::function<bool(const Command &)> &predicate) {
+  std::deque<Command> cancelled;
+  for (auto it = queue_.begin(); it != queue_.end();) {
+    if (predicate(*it)) {
+      cancelled.push_back(std::move(*it));
+      it = queue_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (auto &cmd : cancelled) {
+    if (cmd.callback) {
+      cmd.callback(false, "");
+    }
+  }
+  return cancelled.size();
+}
+
+bool CommandQueue::contains_if(const std::function<bool(const Command &)> &predicate) const {
+  return std::any_of(queue_.begin(), queue_.end(), predicate);
+}
+
 void CommandQueue::set_pending(Command cmd) {
   pending_command_ = std::move(cmd);
 }
@@ -40,12 +66,54 @@ void CommandQueue::clear_pending() {
   pending_command_.reset();
 }
 
-void CommandQueue::retry_pending() {
-  if (pending_command_.has_value() && pending_command_->retry_count < Command::MAX_RETRIES) {
-    pending_command_->retry_count++;
-    queue_.push_front(std::move(*pending_command_));
-    pending_command_.reset();
+bool CommandQueue::retry_pending() {
+  if (!pending_command_.has_value() || pending_command_->retry_count >= Command::MAX_RETRIES) {
+    return false;
+  }
+  pending_command_->retry_count++;
+  queue_.push_front(std::move(*pending_command_));
+  pending_command_.reset();
+  return true;
+}
+
+void CommandQueue::defer(Command cmd) {
+  auto it = std::find_if(deferred_.begin(), deferred_.end(), [&cmd](const Command &queued) {
+    return cmd.info != nullptr && queued.info == cmd.info && queued.type == cmd.type;
+  });
+  if (it == deferred_.end()) {
+    deferred_.push_back(std::move(cmd));
+    return;
+  }
+  if (it->callback && cmd.callback) {
+    auto older = std::move(it->callback);
+    auto newer = std::move(cmd.callback);
+    cmd.callback = [older = std::move(older), newer = std::move(newer)](bool success, const std::string &response) {
+      older(success, response);
+      newer(success, response);
+    };
+  } else if (it->callback) {
+    cmd.callback = std::move(it->callback);
+  }
+  cmd.retry_count = 0;
+  *it = std::move(cmd);
+}
+
+size_t CommandQueue::release_deferred() {
+  size_t released = deferred_.size();
+  queue_.insert(queue_.begin(), std::make_move_iterator(deferred_.begin()), std::make_move_iterator(deferred_.end()));
+  deferred_.clear();
+  return released;
+}
+
+size_t CommandQueue::cancel_deferred() {
+  std::deque<Command> cancelled;
+  cancelled.swap(deferred_);
+  for (auto &cmd : cancelled) {
+    if (cmd.callback) {
+      cmd.callback(false, "");
+    }
   }
+  return cancelled.size();
 }
 
 }  // namespace esphome::epson_projector
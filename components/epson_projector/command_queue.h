@@ -17,15 +17,25 @@ class CommandQueue {
   [[nodiscard]] bool empty() const;
   [[nodiscard]] size_t size() const;
   void clear();
+  size_t cancel_if(const std::function<bool(const Command &)> &predicate);
+  [[nodiscard]] bool contains_if(const std::function<bool(const Command &)> &predicate) const;
 
   [[nodiscard]] bool has_pending_command() const { return pending_command_.has_value(); }
   [[nodiscard]] const std::optional<Command> &pending_command() const { return pending_command_; }
   void set_pending(Command cmd);
   void clear_pending();
-  void retry_pending();
+  bool retry_pending();
+
+  // Writes that need the projector on wait here until it is. A newer write to the same setting replaces the
+  // older one on the wire and keeps its place in line; both callbacks still run, oldest first.
+  void defer(Command cmd);
+  size_t release_deferred();
+  size_t cancel_deferred();
+  [[nodiscard]] size_t deferred_size() const { return deferred_.size(); }
 
  private:
   std::deque<Command> queue_;
+  std::deque<Command> deferred_;
   std::optional<Command> pending_command_;
 };
 
@@ -0,0 +1,84 @@
+#include "command_tap.h"
+
+#include "protocol_constants.h"
+
+#include <cctype>
+
+namespace esphome::epson_projector {
+
+namespace {
+
+std::string_view trim(std::string_view text) {
+  while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+    text.remove_prefix(1);
+  }
+  while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+    text.remove_suffix(1);
+  }
+  return text;
+}
+
+}  // namespace
+
+std::optional<ObservedCommand> parse_observed_command(std::string_view line) {
+  line = trim(line);
+  if (line.empty()) {
+    return std::nullopt;
+  }
+
+  ObservedCommand command;
+  if (line.back() == QUERY_SUFFIX) {
+    line.remove_suffix(1);
+    command.key = trim(line);
+    command.is_query = true;
+  } else {
+    size_t space = line.find(' ');
+    command.key = line.substr(0, space);
+    if (space != std::string_view::npos) {
+      command.value = trim(line.substr(space + 1));
+    }
+  }
+  if (command.key.empty()) {
+    return std::nullopt;
+  }
+  return command;
+}
+
+bool CommandTap::push(uint8_t byte) {
+  if (this->complete_) {
+    this->buffer_.clear();
+    this->complete_ = false;
+  }
+
+  if (byte == 0 || byte > 0x7F || byte == '\n') {
+    return false;
+  }
+  char c = static_cast<char>(byte);
+
+  if (this->discarding_) {
+    this->discarding_ = c != CMD_TERMINATOR;
+    return false;
+  }
+
+  if (c == CMD_TERMINATOR) {
+    this->complete_ = true;
+    return true;
+  }
+
+  if (this->buffer_.size() >= CAPACITY) {
+    this->overflows_++;
+    this->buffer_.clear();
+    this->discarding_ = true;
+    return false;
+  }
+  this->buffer_ += c;
+  return false;
+}
+
+void CommandTap::clear() {
+  this->buffer_.clear();
+  this->complete_ = false;
+  this->discarding_ = false;
+}
+
+}  // namespace esphome::epson_projector
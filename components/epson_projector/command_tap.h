@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace esphome::epson_projector {
+
+// A command seen on the line from another controller to the projector: "KEY?" or "KEY VALUE".
+struct ObservedCommand {
+  std::string key;
+  std::string value;
+  bool is_query{false};
+};
+
+std::optional<ObservedCommand> parse_observed_command(std::string_view line);
+
+// Splits the tapped controller-to-projector stream into '\r'-terminated commands. Like RxFramer, the
+// buffer never grows past CAPACITY; an over-long command is dropped up to the next '\r'.
+class CommandTap {
+ public:
+  static constexpr size_t CAPACITY = 64;
+
+  CommandTap() { this->buffer_.reserve(CAPACITY); }
+
+  // Returns true when `byte` completed a command, which line() then holds until the next push().
+  bool push(uint8_t byte);
+  void clear();
+
+  [[nodiscard]] const std::string &line() const { return this->buffer_; }
+  [[nodiscard]] uint32_t overflows() const { return this->overflows_; }
+
+ private:
+  std::string buffer_;
+  bool complete_{false};
+  bool discarding_{false};
+  uint32_t overflows_{0};
+};
+
+}  // namespace esphome::epson_projector
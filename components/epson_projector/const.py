@@ -1,9 +1,29 @@
 CONF_PROJECTOR_ID = "projector_id"
 CONF_MODEL = "model"
+CONF_LINK_DOWN_THRESHOLD = "link_down_threshold"
+CONF_RESTORE_STATE = "restore_state"
+CONF_TRANSPORT = "transport"
+CONF_TRANSPORT_ID = "transport_id"
+CONF_WIRE_TRACE_SIZE = "wire_trace_size"
+CONF_LOOP_BUDGET = "loop_budget"
+CONF_SNAPSHOT = "snapshot"
+CONF_PASSIVE = "passive"
+CONF_COMMAND_TAP = "command_tap"
+CONF_BRIDGE = "bridge"
+CONF_MAX_CACHE_AGE = "max_cache_age"
+CONF_RX_BYTES_PER_LOOP = "rx_bytes_per_loop"
+CONF_SCENES = "scenes"
+CONF_SCENE = "scene"
+CONF_ON_SCENE_APPLIED = "on_scene_applied"
+
+TRANSPORT_UART = "uart"
+TRANSPORT_TCP = "tcp"
+ESCVP_NET_PORT = 3629
 
 CONF_POWER = "power"
 CONF_MUTE = "mute"
 CONF_POWER_STATE = "power_state"
+CONF_LINK_STATE = "link_state"
 CONF_LAMP_HOURS = "lamp_hours"
 CONF_ERROR_CODE = "error_code"
 CONF_SOURCE = "source"
@@ -47,6 +67,7 @@ ICON_LUMINANCE = "mdi:brightness-auto"
 ICON_GAMMA = "mdi:gamma"
 ICON_FREEZE = "mdi:pause"
 ICON_SERIAL_NUMBER = "mdi:identifier"
+ICON_LINK = "mdi:serial-port"
 
 BRIGHTNESS_MIN = 0
 BRIGHTNESS_MAX = 100
@@ -3,6 +3,8 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 
+#include "state_listener.h"
+
 namespace esphome::epson_projector {
 
 class EpsonProjector;
@@ -25,7 +27,7 @@ bool setup_entity(Entity *entity, const char *tag) {
     entity->mark_failed();
     return false;
   }
-  parent->add_on_state_callback([entity]() { entity->on_state_change(); });
+  parent->add_listener(entity);
   return true;
 }
 
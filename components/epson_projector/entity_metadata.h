@@ -3,6 +3,7 @@
 #include "query_metadata.h"
 
 #include <cstddef>
+#include <optional>
 
 namespace esphome::epson_projector {
 
@@ -145,17 +146,20 @@ constexpr const SensorTypeInfo *find_sensor_type_info(SensorType type) {
 enum class BinarySensorType : uint8_t {
   POWER_STATE,
   MUTE_STATE,
+  LINK_STATE,
 };
 
 struct BinarySensorTypeInfo {
   BinarySensorType type;
-  QueryType query_type;
+  // Empty for sensors that do not reflect a projector query.
+  std::optional<QueryType> query_type;
   const char *name;
 };
 
 inline constexpr BinarySensorTypeInfo BINARY_SENSOR_TYPE_INFO[] = {
     {BinarySensorType::POWER_STATE, QueryType::POWER, "Power State"},
     {BinarySensorType::MUTE_STATE, QueryType::MUTE, "Mute State"},
+    {BinarySensorType::LINK_STATE, std::nullopt, "Link State"},
 };
 
 inline constexpr std::size_t BINARY_SENSOR_TYPE_INFO_SIZE =
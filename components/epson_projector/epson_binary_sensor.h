@@ -9,17 +9,52 @@
 
 namespace esphome::epson_projector {
 
-class EpsonBinarySensor : public binary_sensor::BinarySensor, public Component, public Parented<EpsonProjector> {
+using BinarySensorGetter = bool (EpsonProjector::*)() const;
+
+constexpr BinarySensorGetter binary_sensor_getter(BinarySensorType type) {
+  switch (type) {
+    case BinarySensorType::POWER_STATE:
+      return &EpsonProjector::is_powered;
+    case BinarySensorType::MUTE_STATE:
+      return &EpsonProjector::is_muted;
+    case BinarySensorType::LINK_STATE:
+      return &EpsonProjector::is_link_up;
+  }
+  return nullptr;
+}
+
+class EpsonBinarySensorBase : public binary_sensor::BinarySensor,
+                              public Component,
+                              public Parented<EpsonProjector>,
+                              public StateListener {
  public:
+  explicit EpsonBinarySensorBase(const BinarySensorTypeInfo *info) : info_(info) {}
+
   void setup() override;
   void dump_config() override;
 
-  void set_sensor_type(BinarySensorType type) { this->sensor_type_ = type; }
+ protected:
+  const BinarySensorTypeInfo *info_;
+};
 
-  void on_state_change();
+template <BinarySensorType Type>
+class EpsonBinarySensor : public EpsonBinarySensorBase {
+  static constexpr const BinarySensorTypeInfo *INFO = find_binary_sensor_type_info(Type);
+  static_assert(INFO != nullptr, "Every binary sensor type needs a BINARY_SENSOR_TYPE_INFO entry");
+  static constexpr BinarySensorGetter GETTER = binary_sensor_getter(Type);
+  static_assert(GETTER != nullptr, "Every binary sensor type needs a hub getter");
 
- protected:
-  BinarySensorType sensor_type_{BinarySensorType::POWER_STATE};
+ public:
+  EpsonBinarySensor() : EpsonBinarySensorBase(INFO) {}
+
+  void on_state_change() override {
+    if constexpr (INFO->query_type.has_value()) {
+      if (!this->parent_->has_received(*INFO->query_type)) {
+        return;
+      }
+    }
+    this->publish_state((this->parent_->*GETTER)());
+  }
 };
 
 }  // namespace esphome::epson_projector
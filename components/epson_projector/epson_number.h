@@ -9,19 +9,72 @@
 
 namespace esphome::epson_projector {
 
-class EpsonNumber : public number::Number, public Component, public Parented<EpsonProjector> {
+struct NumberAccessors {
+  int (EpsonProjector::*get)() const;
+  SequenceStep (EpsonProjector::*set)(int, bool);
+};
+
+constexpr NumberAccessors number_accessors(NumberType type) {
+  switch (type) {
+    case NumberType::BRIGHTNESS:
+      return {&EpsonProjector::brightness, &EpsonProjector::set_brightness};
+    case NumberType::CONTRAST:
+      return {&EpsonProjector::contrast, &EpsonProjector::set_contrast};
+    case NumberType::VOLUME:
+      return {&EpsonProjector::volume, &EpsonProjector::set_volume};
+    case NumberType::SHARPNESS:
+      return {&EpsonProjector::sharpness, &EpsonProjector::set_sharpness};
+    case NumberType::DENSITY:
+      return {&EpsonProjector::density, &EpsonProjector::set_density};
+    case NumberType::TINT:
+      return {&EpsonProjector::tint, &EpsonProjector::set_tint};
+    case NumberType::COLOR_TEMPERATURE:
+      return {&EpsonProjector::color_temp, &EpsonProjector::set_color_temp};
+    case NumberType::V_KEYSTONE:
+      return {&EpsonProjector::v_keystone, &EpsonProjector::set_v_keystone};
+    case NumberType::H_KEYSTONE:
+      return {&EpsonProjector::h_keystone, &EpsonProjector::set_h_keystone};
+  }
+  return {nullptr, nullptr};
+}
+
+class EpsonNumberBase : public number::Number,
+                        public Component,
+                        public Parented<EpsonProjector>,
+                        public StateListener {
  public:
+  explicit EpsonNumberBase(const NumberTypeInfo *info) : info_(info) {}
+
   void setup() override;
   void dump_config() override;
 
-  void set_number_type(NumberType type) { this->number_type_ = type; }
+ protected:
+  const NumberTypeInfo *info_;
+};
+
+// One class per number type: query, getter and setter are constants, so notifications never branch on the type.
+template <NumberType Type>
+class EpsonNumber : public EpsonNumberBase {
+  static constexpr const NumberTypeInfo *INFO = find_number_type_info(Type);
+  static_assert(INFO != nullptr, "Every number type needs a NUMBER_TYPE_INFO entry");
+  static constexpr NumberAccessors ACCESSORS = number_accessors(Type);
+  static_assert(ACCESSORS.get != nullptr, "Every number type needs hub accessors");
 
-  void on_state_change();
+ public:
+  EpsonNumber() : EpsonNumberBase(INFO) {}
 
- protected:
-  void control(float value) override;
+  void on_state_change() override {
+    if (!this->parent_->has_received(INFO->query_type) || this->parent_->has_pending_write(INFO->query_type)) {
+      return;
+    }
+    this->publish_state(static_cast<float>((this->parent_->*ACCESSORS.get)()));
+  }
 
-  NumberType number_type_{NumberType::BRIGHTNESS};
+ protected:
+  void control(float value) override {
+    (this->parent_->*ACCESSORS.set)(static_cast<int>(value), false);
+    this->publish_state(value);
+  }
 };
 
 }  // namespace esphome::epson_projector
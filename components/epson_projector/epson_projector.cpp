@@ -1,81 +1,433 @@
 #include "epson_projector.h"
 
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include "value_scale.h"
+
 #include <algorithm>
+#include <cstring>
 #include <ranges>
 
 namespace esphome::epson_projector {
 
 static const char *const TAG = "epson_projector";
 
+static uint8_t to_byte(int value) { return static_cast<uint8_t>(clamp_value(value, 0, UINT8_MAX)); }
+
+// Settings the projector stores per color mode.
+static constexpr QueryType PICTURE_QUERIES[] = {
+    QueryType::LUMINANCE, QueryType::GAMMA,   QueryType::BRIGHTNESS, QueryType::CONTRAST,
+    QueryType::SHARPNESS, QueryType::DENSITY, QueryType::TINT,       QueryType::COLOR_TEMP,
+};
+
+EpsonProjector::~EpsonProjector() {
+  this->detach_from_scheduler();
+  for (SequenceSlot &slot : this->sequences_) {
+    if (slot.handle) {
+      slot.handle.destroy();
+    }
+  }
+}
+
 void EpsonProjector::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Epson Projector...");
-  this->rx_buffer_.reserve(64);
+  if (this->transport_ == nullptr) {
+    ESP_LOGE(TAG, "Transport not set");
+    this->mark_failed();
+    return;
+  }
+  this->transport_->setup();
+  if (this->command_tap_transport_ != nullptr) {
+    this->command_tap_transport_->setup();
+  }
+  if (this->restore_state_) {
+    this->load_state();
+  }
+  this->attach_to_scheduler();
+}
+
+void EpsonProjector::attach_to_scheduler() {
+  EpsonProjector **tail = &first_link_;
+  while (*tail != nullptr && *tail != this) {
+    tail = &(*tail)->next_link_;
+  }
+  *tail = this;
+}
+
+void EpsonProjector::detach_from_scheduler() {
+  for (EpsonProjector **link = &first_link_; *link != nullptr; link = &(*link)->next_link_) {
+    if (*link == this) {
+      *link = this->next_link_;
+      break;
+    }
+  }
+  if (next_serviced_ == this) {
+    next_serviced_ = this->next_link_;
+  }
+  this->next_link_ = nullptr;
 }
 
 void EpsonProjector::loop() {
-  while (this->available()) {
-    char c = this->read();
-    this->rx_buffer_ += c;
+  if (this == first_link_) {
+    this->run_scheduled_links();
+  }
+}
+
+void EpsonProjector::run_scheduled_links() {
+  uint32_t start_us = micros();
+  auto successor = [](EpsonProjector *link) { return link->next_link_ != nullptr ? link->next_link_ : first_link_; };
+
+  EpsonProjector *start = next_serviced_ != nullptr ? next_serviced_ : first_link_;
+  EpsonProjector *link = start;
+  do {
+    link->service_link(start_us, this->loop_budget_us_);
+    link = successor(link);
+  } while (link != start && (this->loop_budget_us_ == 0 || micros() - start_us < this->loop_budget_us_));
+
+  // Links skipped for lack of time go first next pass; otherwise the starting link rotates.
+  next_serviced_ = link == start ? successor(start) : link;
+}
+
+void EpsonProjector::service_link(uint32_t start_us, uint32_t budget_us) {
+  uint32_t link_start_us = micros();
+  if (this->publish_restored_) {
+    this->publish_restored_ = false;
+    this->notify_state_change();
+  }
+
+  this->transport_->loop();
+
+  LoopBudget budget(start_us, budget_us, this->rx_bytes_per_loop_);
+  if (this->passive_) {
+    this->read_tapped_traffic(budget);
+  } else {
+    this->read_responses(budget);
+  }
+  if (budget.exhausted()) {
+    // Unread bytes may hold the reply to the pending command, so timeouts wait for the next pass.
+    this->record_loop_time(link_start_us);
+    return;
+  }
+  this->flush_notifications();
+
+  this->resume_sequences();
+  this->run_scheduler();
+  this->record_loop_time(link_start_us);
+}
+
+void EpsonProjector::add_listener(StateListener *listener) {
+  StateListener **tail = &this->listeners_;
+  while (*tail != nullptr) {
+    tail = &(*tail)->next_listener_;
+  }
+  *tail = listener;
+}
+
+bool EpsonProjector::read_responses(LoopBudget &budget, bool single_frame) {
+  uint8_t byte;
+  while (this->transport_->available() > 0 && budget.take_byte(micros()) && this->transport_->read_byte(&byte)) {
+    FrameStatus status = this->rx_framer_.push(byte);
+    if (status == FrameStatus::NONE) {
+      continue;
+    }
+    if (status == FrameStatus::RESYNC) {
+      this->handle_resync();
+      continue;
+    }
+
+    const std::string &frame = this->rx_framer_.frame();
+#ifdef USE_EPSON_PROJECTOR_WIRE_TRACE
+    auto &pending = this->command_queue_.pending_command();
+    this->wire_trace_.record(TraceDirection::RX, millis(), pending ? pending->info : nullptr, frame);
+#endif
+    ESP_LOGVV(TAG, "Raw response: '%s'", escape_wire_bytes(frame).c_str());
+    if (status == FrameStatus::FRAME || this->is_awaiting_ack()) {
+      this->handle_response(frame);
+    } else {
+      ESP_LOGV(TAG, "Idle prompt");
+    }
+    this->record_link_activity();
+    if (single_frame) {
+      return true;
+    }
+  }
+  return false;
+}
 
-    if (this->response_parser_.is_complete_response(this->rx_buffer_)) {
-      ESP_LOGD(TAG, "Raw response: '%s' (len=%d)", this->format_response_for_log(this->rx_buffer_).c_str(),
-               this->rx_buffer_.length());
-      this->handle_response(this->rx_buffer_);
-      this->rx_buffer_.clear();
+void EpsonProjector::read_tapped_traffic(LoopBudget &budget) {
+  // Both lines are read one message at a time, so each reply is matched to the command that preceded it.
+  bool progress = true;
+  while (progress && !budget.exhausted()) {
+    progress = this->read_tapped_command(budget);
+    progress |= this->read_responses(budget, true);
+  }
+}
+
+bool EpsonProjector::read_tapped_command(LoopBudget &budget) {
+  Transport *tap = this->command_tap_transport_;
+  if (tap == nullptr) {
+    return false;
+  }
+  uint8_t byte;
+  while (tap->available() > 0 && budget.take_byte(micros()) && tap->read_byte(&byte)) {
+    if (this->command_tap_.push(byte)) {
+      this->observe_command(this->command_tap_.line());
+      return true;
     }
   }
+  return false;
+}
+
+void EpsonProjector::observe_command(const std::string &line) {
+  auto observed = parse_observed_command(line);
+  if (!observed) {
+    return;
+  }
+#ifdef USE_EPSON_PROJECTOR_WIRE_TRACE
+  this->wire_trace_.record(TraceDirection::TX, millis(), find_query_info(observed->key), line);
+#endif
+  auto &pending = this->command_queue_.pending_command();
+  if (pending) {
+    ESP_LOGV(TAG, "No reply seen to '%s'", escape_wire_bytes(pending->command_str).c_str());
+    this->command_queue_.clear_pending();
+  }
 
+  const QueryInfo *info = find_query_info(observed->key);
+  std::function<void(bool, const std::string &)> callback;
+  if (!observed->is_query && info != nullptr) {
+    callback = [this, info, value = std::move(observed->value)](bool success, const std::string &) {
+      if (success) {
+        this->apply_observed_write(*info, value);
+      }
+    };
+  }
+  ESP_LOGV(TAG, "Observed: %s", line.c_str());
+  CommandType type = observed->is_query ? CommandType::QUERY : CommandType::SET;
+  this->command_queue_.set_pending(Command{line, type, std::move(callback), 0, info});
+  this->last_command_time_ = millis();
+}
+
+void EpsonProjector::apply_observed_write(const QueryInfo &info, const std::string &value) {
+  if (info.type == QueryType::POWER) {
+    PowerState previous = this->state_.power;
+    this->state_.power = value == ARG_ON ? PowerState::WARMUP : PowerState::COOLDOWN;
+    this->mark_received(QueryType::POWER);
+    this->on_power_state_change(previous);
+    this->notify_state_change();
+    return;
+  }
+  // Relative steps such as "VOL INC" say nothing about the new value; the next observed query will.
+  if (value == "INC" || value == "DEC" || value == "INIT") {
+    return;
+  }
+  auto result = this->response_parser_.parse(std::string(info.cmd) + RESPONSE_SEPARATOR + value);
+  if (!result) {
+    ESP_LOGV(TAG, "Observed %s %s not decoded: %s", info.cmd, value.c_str(), result.error().c_str());
+    return;
+  }
+  this->apply_response(*result);
+}
+
+bool EpsonProjector::is_awaiting_ack() const {
+  auto &pending = this->command_queue_.pending_command();
+  return pending && pending->type != CommandType::QUERY;
+}
+
+void EpsonProjector::handle_resync() {
+  ESP_LOGW(TAG, "Receive buffer overflow, resynchronized at next CR (%u overflows)", this->rx_framer_.overflows());
+  auto &pending = this->command_queue_.pending_command();
+  if (!pending || (!this->passive_ && this->command_queue_.retry_pending())) {
+    return;
+  }
+  if (pending->callback) {
+    pending->callback(false, "");
+  }
+  this->command_queue_.clear_pending();
+}
+
+void EpsonProjector::run_scheduler() {
   uint32_t now = millis();
+  if (this->state_dirty_ && now - this->last_save_time_ >= STATE_SAVE_INTERVAL_MS) {
+    this->save_state(false);
+  }
+
+  if (this->passive_) {
+    // A command the projector never answered is forgotten; it is not ours to retry.
+    if (this->command_queue_.has_pending_command() && now - this->last_command_time_ > BUSY_TIMEOUT_MS) {
+      this->command_queue_.clear_pending();
+    }
+    return;
+  }
+
+  if (is_transitional(this->state_.power) && !this->link_monitor_.is_down() &&
+      now - this->last_power_poll_time_ >= TRANSITION_POLL_INTERVAL_MS) {
+    this->last_power_poll_time_ = now;
+    this->query(QueryType::POWER);
+  }
+
   if (this->command_queue_.has_pending_command()) {
     uint32_t timeout = this->is_busy_state() ? BUSY_TIMEOUT_MS : RESPONSE_TIMEOUT_MS;
     if (now - this->last_command_time_ > timeout) {
-      if (!this->is_busy_state()) {
-        ESP_LOGW(TAG, "Command timeout");
-      }
-      auto &pending = this->command_queue_.pending_command();
-      if (pending && pending->callback) {
-        pending->callback(false, "");
-      }
-      this->command_queue_.retry_pending();
-      this->last_command_time_ = now;
+      this->handle_timeout(now);
     }
-  } else if (!this->command_queue_.empty()) {
-    uint32_t delay = this->initial_query_done_ ? COMMAND_DELAY_MS : INITIAL_QUERY_DELAY_MS;
+    return;
+  }
+
+  if (this->link_monitor_.probe_due(now)) {
+    ESP_LOGD(TAG, "Probing link (interval %u ms)", this->link_monitor_.probe_interval());
+    this->link_monitor_.mark_probe_sent(now);
+    const QueryInfo *power = find_query_info(QueryType::POWER);
+    this->command_queue_.enqueue_priority(
+        Command{build_query_command(power->cmd), CommandType::QUERY, nullptr, 0, power});
+  }
+
+  if (this->command_queue_.empty()) {
+    this->refresh_burst_ = false;
+  } else {
+    bool fast = !this->initial_query_done_ || this->refresh_burst_;
+    uint32_t delay = fast ? INITIAL_QUERY_DELAY_MS : COMMAND_DELAY_MS;
     if (now - this->last_command_time_ > delay) {
       this->process_queue();
     }
   }
 }
 
-std::string EpsonProjector::format_response_for_log(const std::string &response) {
-  std::string result;
-  for (char c : response) {
-    if (c == '\r') {
-      result += "\\r";
-    } else if (c == '\n') {
-      result += "\\n";
-    } else if (c < 32 || c > 126) {
-      char hex[8];
-      snprintf(hex, sizeof(hex), "\\x%02X", static_cast<unsigned char>(c));
-      result += hex;
-    } else {
-      result += c;
+void EpsonProjector::handle_timeout(uint32_t now) {
+  bool busy = this->is_busy_state();
+  if (!busy) {
+    ESP_LOGW(TAG, "Command timeout");
+    LinkState previous = this->link_monitor_.state();
+    if (this->link_monitor_.record_timeout(now)) {
+      this->on_link_state_change(previous);
     }
   }
-  return result;
+
+  if (this->link_monitor_.is_down() || !this->command_queue_.retry_pending()) {
+    auto &pending = this->command_queue_.pending_command();
+    if (pending && pending->callback) {
+      pending->callback(false, "");
+    }
+    this->command_queue_.clear_pending();
+  }
+  this->last_command_time_ = now;
+}
+
+void EpsonProjector::record_link_activity() {
+  LinkState previous = this->link_monitor_.state();
+  if (this->link_monitor_.record_response()) {
+    this->on_link_state_change(previous);
+  }
+}
+
+void EpsonProjector::on_link_state_change(LinkState previous) {
+  LinkState current = this->link_monitor_.state();
+  switch (current) {
+    case LinkState::DOWN: {
+      // Queued writes fail too, so entities fall back to confirmed values and the probes are not stuck behind them.
+      size_t cancelled = this->command_queue_.cancel_if([](const Command &) { return true; });
+      ESP_LOGW(TAG, "Projector link down after %u timeouts, cancelled %u queued commands",
+               this->link_monitor_.consecutive_timeouts(), static_cast<unsigned>(cancelled));
+      break;
+    }
+    case LinkState::DEGRADED:
+      ESP_LOGD(TAG, "Projector link degraded");
+      break;
+    case LinkState::UP:
+      ESP_LOGI(TAG, "Projector link up");
+      break;
+  }
+  this->notify_state_change();
+
+  if (previous == LinkState::DOWN && current == LinkState::UP) {
+    this->update();
+  }
+}
+
+void EpsonProjector::on_power_state_change(PowerState previous) {
+  switch (classify_power_transition(previous, this->state_.power)) {
+    case PowerTransition::WARMING_UP:
+    case PowerTransition::COOLING_DOWN:
+      ESP_LOGD(TAG, "Power transition started, polling every %u ms", TRANSITION_POLL_INTERVAL_MS);
+      this->last_power_poll_time_ = millis();
+      break;
+    case PowerTransition::POWERED_ON:
+      if (this->query_support_.retired_mask() != 0) {
+        ESP_LOGD(TAG, "Re-probing queries retired before power cycle");
+        this->query_support_.reset();
+      }
+      this->queue_refresh_burst();
+      if (size_t released = this->command_queue_.release_deferred(); released > 0) {
+        ESP_LOGI(TAG, "Projector on, sending %u held settings", static_cast<unsigned>(released));
+        this->refresh_burst_ = true;
+      }
+      break;
+    case PowerTransition::POWERED_OFF: {
+      this->refresh_burst_ = false;
+      size_t dropped = this->command_queue_.cancel_if([](const Command &cmd) {
+        return cmd.type == CommandType::QUERY && cmd.info != nullptr && cmd.info->requires_power_on;
+      });
+      ESP_LOGD(TAG, "Projector in standby, dropped %u queued queries", static_cast<unsigned>(dropped));
+      break;
+    }
+    case PowerTransition::NONE:
+      break;
+  }
+}
+
+void EpsonProjector::queue_refresh_burst() {
+  if (this->passive_) {
+    return;
+  }
+  this->command_queue_.cancel_if([](const Command &cmd) {
+    return cmd.type == CommandType::QUERY && cmd.info != nullptr && cmd.info->requires_power_on;
+  });
+
+  size_t queued = 0;
+  for (const auto &info : QUERY_TABLE | std::views::reverse) {
+    if (!info.requires_power_on || !this->has_query(info.type) || this->query_support_.is_retired(info.type)) {
+      continue;
+    }
+    Command command{build_query_command(info.cmd), CommandType::QUERY, nullptr, 0, &info};
+    this->command_queue_.enqueue_priority(std::move(command));
+    queued++;
+  }
+  this->refresh_burst_ = queued > 0;
+  ESP_LOGD(TAG, "Projector on, refreshing %u queries", static_cast<unsigned>(queued));
 }
 
 bool EpsonProjector::is_busy_state() const {
-  return this->power_state_ == PowerState::WARMUP || this->power_state_ == PowerState::COOLDOWN;
+  return is_transitional(this->state_.power);
+}
+
+bool EpsonProjector::is_power_gated(const Command &cmd) const {
+  if (cmd.type != CommandType::SET || cmd.info == nullptr || !cmd.info->requires_power_on) {
+    return false;
+  }
+  return this->state_.power == PowerState::STANDBY || is_transitional(this->state_.power);
+}
+
+void EpsonProjector::cancel_power_gated_writes() {
+  size_t cancelled = this->command_queue_.cancel_deferred();
+  cancelled += this->command_queue_.cancel_if([](const Command &cmd) {
+    return cmd.type == CommandType::SET && cmd.info != nullptr && cmd.info->requires_power_on;
+  });
+  if (cancelled > 0) {
+    ESP_LOGW(TAG, "Power off requested, cancelled %u settings waiting for power on", static_cast<unsigned>(cancelled));
+  }
 }
 
 void EpsonProjector::update() {
-  bool is_on = (this->power_state_ == PowerState::ON || this->power_state_ == PowerState::WARMUP);
+  if (this->passive_ || this->link_monitor_.is_down()) {
+    return;
+  }
+
+  bool is_on = this->state_.power == PowerState::ON;
 
   if (!this->initial_query_done_) {
-    bool all_received = (this->received_queries_ & this->registered_queries_) == this->registered_queries_;
+    uint32_t confirmed = this->received_queries_ & ~this->unconfirmed_queries_;
+    bool all_received = (confirmed & this->registered_queries_) == this->registered_queries_;
     if (all_received && this->registered_queries_ != 0) {
       this->initial_query_done_ = true;
       ESP_LOGD(TAG, "Initial queries complete");
@@ -83,7 +435,8 @@ void EpsonProjector::update() {
   }
 
   auto should_query = [this, is_on](const QueryInfo &info) {
-    return this->has_query(info.type) && (!info.requires_power_on || is_on);
+    return this->has_query(info.type) && !this->query_support_.is_retired(info.type) &&
+           (!info.requires_power_on || is_on);
   };
   for (const auto &info : QUERY_TABLE | std::views::filter(should_query)) {
     this->query(info.type);
@@ -92,241 +445,806 @@ void EpsonProjector::update() {
 
 void EpsonProjector::dump_config() {
   ESP_LOGCONFIG(TAG, "Epson Projector:");
-  ESP_LOGCONFIG(TAG, "  Power State: %d", compat::to_underlying(this->power_state_));
-  ESP_LOGCONFIG(TAG, "  Lamp Hours: %u", this->lamp_hours_);
+  ESP_LOGCONFIG(TAG, "  Model: %s", this->model_name_);
+  for (const auto &info : QUERY_TABLE) {
+    if (!this->supports(info.type)) {
+      ESP_LOGCONFIG(TAG, "  Not supported by model: %s", info.cmd);
+    }
+  }
+  if (this->transport_ != nullptr) {
+    this->transport_->dump_config();
+  }
+  if (this->passive_) {
+    ESP_LOGCONFIG(TAG, "  Passive: listening only, command tap %s",
+                  this->command_tap_transport_ != nullptr ? "configured" : "not configured");
+    if (this->command_tap_transport_ != nullptr) {
+      this->command_tap_transport_->dump_config();
+    }
+  }
+  ESP_LOGCONFIG(TAG, "  Power State: %d", compat::to_underlying(this->state_.power));
+  ESP_LOGCONFIG(TAG, "  Lamp Hours: %u", this->state_.lamp_hours);
+  ESP_LOGCONFIG(TAG, "  Link State: %s", link_state_to_string(this->link_monitor_.state()));
+  ESP_LOGCONFIG(TAG, "  Link Down Threshold: %u timeouts", this->link_monitor_.down_threshold());
+  ESP_LOGCONFIG(TAG, "  Restore State: %s", YESNO(this->restore_state_));
+  ESP_LOGCONFIG(TAG, "  Loop Budget: %u us, %u bytes", this->loop_budget_us_, this->rx_bytes_per_loop_);
+  ESP_LOGCONFIG(TAG, "  Worst Loop Time: %u us", this->max_loop_time_us_);
+  if (this == first_link_ && this->next_link_ != nullptr) {
+    size_t links = 0;
+    for (EpsonProjector *link = first_link_; link != nullptr; link = link->next_link_) {
+      links++;
+    }
+    ESP_LOGCONFIG(TAG, "  Scheduler: drives %u projector links", static_cast<unsigned>(links));
+  }
+  ESP_LOGCONFIG(TAG, "  Receive Overflows: %u, resyncs: %u, dropped bytes: %u", this->rx_framer_.overflows(),
+                this->rx_framer_.resyncs(), this->rx_framer_.dropped_bytes());
+  for (const auto &info : QUERY_TABLE) {
+    if (this->query_support_.is_retired(info.type)) {
+      ESP_LOGCONFIG(TAG, "  Rejected by projector: %s", info.cmd);
+    }
+  }
+#ifdef USE_EPSON_PROJECTOR_WIRE_TRACE
+  this->dump_wire_trace();
+#endif
 }
 
-void EpsonProjector::send_int_command(const char *cmd, int min_val, int max_val, int value,
-                                      int EpsonProjector::*member) {
-  int clamped = clamp_value(value, min_val, max_val);
-  std::string cmd_str = build_set_command(cmd, clamped);
-  this->send_command(cmd_str, CommandType::SET, [this, member, clamped](bool success, const std::string &) {
-    if (success) {
-      this->*member = clamped;
-      this->notify_state_change();
+void EpsonProjector::dump_wire_trace() {
+#ifdef USE_EPSON_PROJECTOR_WIRE_TRACE
+  ESP_LOGI(TAG, "Wire trace (%u of %u frames):", static_cast<unsigned>(this->wire_trace_.size()),
+           static_cast<unsigned>(this->wire_trace_.capacity()));
+  for (size_t i = 0; i < this->wire_trace_.size(); i++) {
+    ESP_LOGI(TAG, "  %s", format_trace_frame(this->wire_trace_.at(i)).c_str());
+  }
+#else
+  ESP_LOGW(TAG, "Wire trace is disabled, set wire_trace_size to enable it");
+#endif
+}
+
+void EpsonProjector::write_snapshot(std::string &out) const {
+  JsonWriter writer(out);
+  writer.begin_object();
+  writer.key("model");
+  writer.string(this->model_name_);
+  writer.key("now_ms");
+  writer.number(millis());
+  writer.key("link");
+  writer.begin_object();
+  writer.key("state");
+  writer.string(link_state_to_string(this->link_monitor_.state()));
+  writer.key("timeouts");
+  writer.number(this->link_monitor_.consecutive_timeouts());
+  writer.key("rx_overflows");
+  writer.number(this->rx_framer_.overflows());
+  writer.key("max_loop_us");
+  writer.number(this->max_loop_time_us_);
+  writer.end_object();
+  writer.key("queries");
+  writer.begin_object();
+  for (const auto &info : QUERY_TABLE) {
+    if (!this->has_received(info.type)) {
+      continue;
     }
-  });
+    writer.key(info.cmd);
+    writer.begin_object();
+    writer.key("value");
+    this->write_query_value(writer, info.type);
+    // Values restored from flash have not been confirmed by the projector since boot.
+    if (this->is_confirmed(info.type)) {
+      writer.key("confirmed_ms");
+      writer.number(this->confirmed_at_[compat::to_underlying(info.type)]);
+    }
+    if (this->has_pending_write(info.type)) {
+      writer.key("pending");
+      writer.boolean(true);
+    }
+    writer.end_object();
+  }
+  writer.end_object();
+  writer.end_object();
 }
 
-void EpsonProjector::send_bool_command(const char *cmd, bool value, bool EpsonProjector::*member) {
-  std::string cmd_str = build_set_command(cmd, value ? ARG_ON : ARG_OFF);
-  this->send_command(cmd_str, CommandType::SET, [this, member, value](bool success, const std::string &) {
-    if (success) {
-      this->*member = value;
-      this->notify_state_change();
+void EpsonProjector::write_query_value(JsonWriter &writer, QueryType type) const {
+  switch (type) {
+    case QueryType::POWER:
+      writer.string(power_state_to_string(this->state_.power));
+      break;
+    case QueryType::LAMP_HOURS:
+      writer.number(this->state_.lamp_hours);
+      break;
+    case QueryType::ERROR_CODE:
+      writer.number(this->state_.error_code);
+      break;
+    case QueryType::SOURCE:
+      writer.string(this->state_.source.view());
+      break;
+    case QueryType::MUTE:
+      writer.boolean(this->state_.has_flag(STATE_FLAG_MUTED));
+      break;
+    case QueryType::VOLUME:
+      writer.number(this->state_.volume);
+      break;
+    case QueryType::BRIGHTNESS:
+      writer.number(this->state_.brightness);
+      break;
+    case QueryType::CONTRAST:
+      writer.number(this->state_.contrast);
+      break;
+    case QueryType::COLOR_MODE:
+      writer.string(this->state_.color_mode.view());
+      break;
+    case QueryType::ASPECT_RATIO:
+      writer.string(this->state_.aspect_ratio.view());
+      break;
+    case QueryType::SHARPNESS:
+      writer.number(this->state_.sharpness);
+      break;
+    case QueryType::DENSITY:
+      writer.number(this->state_.density);
+      break;
+    case QueryType::TINT:
+      writer.number(this->state_.tint);
+      break;
+    case QueryType::COLOR_TEMP:
+      writer.number(this->state_.color_temp);
+      break;
+    case QueryType::V_KEYSTONE:
+      writer.number(this->state_.v_keystone);
+      break;
+    case QueryType::H_KEYSTONE:
+      writer.number(this->state_.h_keystone);
+      break;
+    case QueryType::H_REVERSE:
+      writer.boolean(this->state_.has_flag(STATE_FLAG_H_REVERSE));
+      break;
+    case QueryType::V_REVERSE:
+      writer.boolean(this->state_.has_flag(STATE_FLAG_V_REVERSE));
+      break;
+    case QueryType::LUMINANCE:
+      writer.string(this->state_.luminance.view());
+      break;
+    case QueryType::GAMMA:
+      writer.string(this->state_.gamma.view());
+      break;
+    case QueryType::FREEZE:
+      writer.boolean(this->state_.has_flag(STATE_FLAG_FROZEN));
+      break;
+    case QueryType::SERIAL_NUMBER:
+      writer.string(this->state_.serial_number.view());
+      break;
+  }
+}
+
+bool EpsonProjector::forward(const std::string &line, std::function<void(bool, const std::string &)> reply) {
+  auto command = parse_observed_command(line);
+  if (!command) {
+    return false;
+  }
+  const QueryInfo *info = find_query_info(command->key);
+  CommandType type = command->is_query ? CommandType::QUERY : CommandType::SET;
+  bool tracked_write = type == CommandType::SET && info != nullptr;
+  // Counted like a local write so neither the cache nor a poll result reports the old value meanwhile.
+  if (tracked_write) {
+    this->pending_writes_[compat::to_underlying(info->type)]++;
+  }
+  auto callback = [this, info, tracked_write, command = std::move(*command), reply = std::move(reply)](
+                      bool success, const std::string &response) {
+    if (tracked_write) {
+      this->pending_writes_[compat::to_underlying(info->type)]--;
+      if (success) {
+        this->apply_observed_write(*info, command.value);
+      } else {
+        this->notify_state_change();
+      }
     }
-  });
+    reply(success, response);
+  };
+  // Remote writes are not held for power on; the client gets the projector's own ERR instead.
+  this->send_command(line + CMD_TERMINATOR, type, std::move(callback),
+                     type == CommandType::QUERY ? info : nullptr);
+  return true;
+}
+
+bool EpsonProjector::cached_reply(QueryType type, uint32_t max_age_ms, std::string &out) const {
+  const QueryInfo *info = find_query_info(type);
+  if (info == nullptr || !this->is_fresh(type, max_age_ms) || this->has_pending_write(type) || !this->is_link_up()) {
+    return false;
+  }
+  if (info->requires_power_on && this->state_.power != PowerState::ON) {
+    return false;
+  }
+  out = info->cmd;
+  out += RESPONSE_SEPARATOR;
+  if (!this->append_wire_value(out, type)) {
+    return false;
+  }
+  out += CMD_TERMINATOR;
+  out += RESPONSE_PROMPT;
+  return true;
 }
 
-void EpsonProjector::send_string_command(const char *cmd, const std::string &value,
-                                         std::string EpsonProjector::*member) {
-  std::string cmd_str = build_set_command(cmd, value.c_str());
-  this->send_command(cmd_str, CommandType::SET, [this, member, value](bool success, const std::string &) {
+bool EpsonProjector::append_wire_value(std::string &out, QueryType type) const {
+  auto append_flag = [this, &out](StateFlag flag) { out += this->state_.has_flag(flag) ? ARG_ON : ARG_OFF; };
+  auto append_two_digits = [&out](unsigned value) {
+    out += static_cast<char>('0' + value / 10 % 10);
+    out += static_cast<char>('0' + value % 10);
+  };
+  switch (type) {
+    case QueryType::POWER:
+      if (this->state_.power == PowerState::UNKNOWN) {
+        return false;
+      }
+      append_two_digits(compat::to_underlying(this->state_.power));
+      break;
+    case QueryType::LAMP_HOURS:
+      out += std::to_string(this->state_.lamp_hours);
+      break;
+    case QueryType::ERROR_CODE:
+      append_two_digits(this->state_.error_code);
+      break;
+    case QueryType::SOURCE:
+      out += this->state_.source.view();
+      break;
+    case QueryType::MUTE:
+      append_flag(STATE_FLAG_MUTED);
+      break;
+    case QueryType::VOLUME:
+    case QueryType::BRIGHTNESS:
+    case QueryType::CONTRAST:
+    case QueryType::SHARPNESS:
+    case QueryType::DENSITY:
+    case QueryType::TINT:
+    case QueryType::COLOR_TEMP:
+    case QueryType::V_KEYSTONE:
+    case QueryType::H_KEYSTONE:
+      // The raw value as the projector last reported or accepted it; rescaling the UI value could differ by a step.
+      out += std::to_string(this->raw_values_[compat::to_underlying(type)]);
+      break;
+    case QueryType::COLOR_MODE:
+      out += this->state_.color_mode.view();
+      break;
+    case QueryType::ASPECT_RATIO:
+      out += this->state_.aspect_ratio.view();
+      break;
+    case QueryType::H_REVERSE:
+      append_flag(STATE_FLAG_H_REVERSE);
+      break;
+    case QueryType::V_REVERSE:
+      append_flag(STATE_FLAG_V_REVERSE);
+      break;
+    case QueryType::LUMINANCE:
+      out += this->state_.luminance.view();
+      break;
+    case QueryType::GAMMA:
+      out += this->state_.gamma.view();
+      break;
+    case QueryType::FREEZE:
+      append_flag(STATE_FLAG_FROZEN);
+      break;
+    case QueryType::SERIAL_NUMBER:
+      out += this->state_.serial_number.view();
+      break;
+  }
+  return true;
+}
+
+void EpsonProjector::on_safe_shutdown() {
+  this->save_state(true);
+}
+
+void EpsonProjector::load_state() {
+  this->state_pref_ = global_preferences->make_preference<PersistedState>(this->state_key_);
+  PersistedState state{};
+  if (!this->state_pref_.load(&state) || !is_compatible(state)) {
+    ESP_LOGD(TAG, "No saved state to restore");
+    return;
+  }
+  this->apply_state(state);
+  this->last_saved_state_ = state;
+  this->publish_restored_ = true;
+  ESP_LOGI(TAG, "Restored last known state, waiting for projector to confirm");
+}
+
+void EpsonProjector::save_state(bool force) {
+  if (!this->restore_state_ || (!this->state_dirty_ && !force)) {
+    return;
+  }
+  this->state_dirty_ = false;
+  this->last_save_time_ = millis();
+
+  PersistedState state = this->capture_state();
+  if (std::memcmp(&state, &this->last_saved_state_, sizeof(state)) == 0) {
+    return;
+  }
+  if (this->state_pref_.save(&state)) {
+    this->last_saved_state_ = state;
+    ESP_LOGD(TAG, "Saved projector state");
+  }
+}
+
+PersistedState EpsonProjector::capture_state() const {
+  PersistedState state;
+  std::memset(&state, 0, sizeof(state));
+  const ProjectorState &live = this->state_;
+
+  state.version = PERSISTED_STATE_VERSION;
+  state.power_state = compat::to_underlying(live.power);
+  state.flags = live.flags;
+  state.error_code = live.error_code;
+  state.lamp_hours = live.lamp_hours;
+  state.received_queries = this->received_queries_;
+  state.volume = live.volume;
+  state.brightness = live.brightness;
+  state.contrast = live.contrast;
+  state.sharpness = live.sharpness;
+  state.density = live.density;
+  state.tint = live.tint;
+  state.color_temp = live.color_temp;
+  state.v_keystone = live.v_keystone;
+  state.h_keystone = live.h_keystone;
+  store_fixed(state.source, live.source.view());
+  store_fixed(state.color_mode, live.color_mode.view());
+  store_fixed(state.aspect_ratio, live.aspect_ratio.view());
+  store_fixed(state.luminance, live.luminance.view());
+  store_fixed(state.gamma, live.gamma.view());
+  store_fixed(state.serial_number, live.serial_number.view());
+  return state;
+}
+
+void EpsonProjector::apply_state(const PersistedState &state) {
+  ProjectorState &live = this->state_;
+  // The projector may have changed power while we were off, so power waits for the first poll.
+  live.power = PowerState::UNKNOWN;
+  live.flags = state.flags;
+  live.error_code = state.error_code;
+  live.lamp_hours = state.lamp_hours;
+  live.volume = state.volume;
+  live.brightness = state.brightness;
+  live.contrast = state.contrast;
+  live.sharpness = state.sharpness;
+  live.density = state.density;
+  live.tint = state.tint;
+  live.color_temp = state.color_temp;
+  live.v_keystone = state.v_keystone;
+  live.h_keystone = state.h_keystone;
+  live.source = load_fixed(state.source);
+  live.color_mode = load_fixed(state.color_mode);
+  live.aspect_ratio = load_fixed(state.aspect_ratio);
+  live.luminance = load_fixed(state.luminance);
+  live.gamma = load_fixed(state.gamma);
+  live.serial_number = load_fixed(state.serial_number);
+  uint32_t restored = state.received_queries & ~query_bit(QueryType::POWER);
+  this->received_queries_ |= restored;
+  this->unconfirmed_queries_ = restored;
+}
+
+bool EpsonProjector::apply_scene(const std::string &name) {
+  auto it = std::ranges::find(this->scenes_, name, &PictureScene::name);
+  if (it == this->scenes_.end()) {
+    ESP_LOGW(TAG, "Unknown scene: %s", name.c_str());
+    return false;
+  }
+
+  auto fields = diff_scene(*it, this->current_picture());
+  ESP_LOGI(TAG, "Applying scene %s (%u settings to change)", name.c_str(), static_cast<unsigned>(fields.size()));
+
+  auto batch = std::make_shared<SceneBatch>();
+  batch->name = name;
+  batch->remaining = 1;
+  this->active_batch_ = batch;
+  for (SceneField field : fields) {
+    this->write_scene_field(*it, field);
+  }
+  this->active_batch_ = nullptr;
+  this->complete_batch_step(batch, true);
+  return true;
+}
+
+PictureScene EpsonProjector::current_picture() const {
+  PictureScene current;
+  auto known = [this](QueryType type) { return this->is_confirmed(type) && !this->has_pending_write(type); };
+  if (known(QueryType::COLOR_MODE)) {
+    current.color_mode = std::string(this->state_.color_mode.view());
+  }
+  if (known(QueryType::LUMINANCE)) {
+    current.luminance = std::string(this->state_.luminance.view());
+  }
+  if (known(QueryType::GAMMA)) {
+    current.gamma = std::string(this->state_.gamma.view());
+  }
+  if (known(QueryType::BRIGHTNESS)) {
+    current.brightness = this->state_.brightness;
+  }
+  if (known(QueryType::CONTRAST)) {
+    current.contrast = this->state_.contrast;
+  }
+  if (known(QueryType::SHARPNESS)) {
+    current.sharpness = this->state_.sharpness;
+  }
+  if (known(QueryType::DENSITY)) {
+    current.density = this->state_.density;
+  }
+  if (known(QueryType::TINT)) {
+    current.tint = this->state_.tint;
+  }
+  if (known(QueryType::COLOR_TEMP)) {
+    current.color_temp = this->state_.color_temp;
+  }
+  return current;
+}
+
+void EpsonProjector::write_scene_field(const PictureScene &scene, SceneField field) {
+  // diff_scene() has already dropped fields that match. The rest are sent even if the cache agrees, because a
+  // color mode change resets the fields after it on the projector.
+  switch (field) {
+    case SceneField::COLOR_MODE:
+      if constexpr (query_compiled_in(QueryType::COLOR_MODE)) {
+        this->set_color_mode(*scene.color_mode, true);
+      }
+      break;
+    case SceneField::LUMINANCE:
+      if constexpr (query_compiled_in(QueryType::LUMINANCE)) {
+        this->set_luminance(*scene.luminance, true);
+      }
+      break;
+    case SceneField::GAMMA:
+      if constexpr (query_compiled_in(QueryType::GAMMA)) {
+        this->set_gamma(*scene.gamma, true);
+      }
+      break;
+    case SceneField::BRIGHTNESS:
+      if constexpr (query_compiled_in(QueryType::BRIGHTNESS)) {
+        this->set_brightness(*scene.brightness, true);
+      }
+      break;
+    case SceneField::CONTRAST:
+      if constexpr (query_compiled_in(QueryType::CONTRAST)) {
+        this->set_contrast(*scene.contrast, true);
+      }
+      break;
+    case SceneField::SHARPNESS:
+      if constexpr (query_compiled_in(QueryType::SHARPNESS)) {
+        this->set_sharpness(*scene.sharpness, true);
+      }
+      break;
+    case SceneField::DENSITY:
+      if constexpr (query_compiled_in(QueryType::DENSITY)) {
+        this->set_density(*scene.density, true);
+      }
+      break;
+    case SceneField::TINT:
+      if constexpr (query_compiled_in(QueryType::TINT)) {
+        this->set_tint(*scene.tint, true);
+      }
+      break;
+    case SceneField::COLOR_TEMP:
+      if constexpr (query_compiled_in(QueryType::COLOR_TEMP)) {
+        this->set_color_temp(*scene.color_temp, true);
+      }
+      break;
+  }
+}
+
+void EpsonProjector::complete_batch_step(const std::shared_ptr<SceneBatch> &batch, bool success) {
+  if (!success) {
+    batch->failed = true;
+  }
+  if (--batch->remaining > 0) {
+    return;
+  }
+  ESP_LOGI(TAG, "Scene %s %s", batch->name.c_str(), batch->failed ? "partially applied" : "applied");
+  std::ranges::for_each(this->scene_callbacks_, [&batch](auto &cb) { cb(batch->name, !batch->failed); });
+}
+
+SequenceStep EpsonProjector::send_write(QueryType type, const std::string &cmd, std::function<void()> apply) {
+  this->pending_writes_[compat::to_underlying(type)]++;
+  auto batch = this->active_batch_;
+  if (batch) {
+    batch->remaining++;
+  }
+  auto callback = [this, type, batch, apply = std::move(apply)](bool success, const std::string &) {
+    this->pending_writes_[compat::to_underlying(type)]--;
     if (success) {
-      this->*member = value;
-      this->notify_state_change();
+      apply();
+      this->mark_received(type);
+    } else {
+      const QueryInfo *info = find_query_info(type);
+      ESP_LOGW(TAG, "%s write failed, restoring last confirmed value", info != nullptr ? info->cmd : "?");
     }
+    this->notify_state_change();
+    if (batch) {
+      this->complete_batch_step(batch, success);
+    }
+  };
+  return this->send_command(cmd, CommandType::SET, std::move(callback), find_query_info(type));
+}
+
+bool EpsonProjector::skip_write(QueryType type, bool matches, bool force) {
+  // A value is trusted until the next poll could have corrected it; after that the remote may have changed it.
+  uint32_t window = this->get_update_interval() + RESPONSE_TIMEOUT_MS;
+  if (force || !matches || !this->is_fresh(type, window) || this->has_pending_write(type)) {
+    return false;
+  }
+  const QueryInfo *info = find_query_info(type);
+  ESP_LOGV(TAG, "%s already at requested value, not sending", info != nullptr ? info->cmd : "?");
+  this->notify_state_change();
+  return true;
+}
+
+template <int UiMax>
+SequenceStep EpsonProjector::send_scaled_command(QueryType type, int value, uint8_t ProjectorState::*member,
+                                                 bool force) {
+  int clamped = clamp_value(value, 0, UiMax);
+  if (this->skip_write(type, this->state_.*member == clamped, force)) {
+    return this->sequence_step();
+  }
+  int raw = ValueScale<UiMax>::to_raw(clamped);
+  std::string cmd_str = build_set_command(find_query_info(type)->cmd, raw);
+  return this->send_write(type, cmd_str, [this, type, member, clamped, raw]() {
+    this->state_.*member = static_cast<uint8_t>(clamped);
+    this->raw_values_[compat::to_underlying(type)] = static_cast<uint8_t>(raw);
   });
 }
 
-void EpsonProjector::set_power(bool on) {
+SequenceStep EpsonProjector::send_bool_command(QueryType type, bool value, StateFlag flag, bool force) {
+  if (this->skip_write(type, this->state_.has_flag(flag) == value, force)) {
+    return this->sequence_step();
+  }
+  std::string cmd_str = build_set_command(find_query_info(type)->cmd, value ? ARG_ON : ARG_OFF);
+  return this->send_write(type, cmd_str, [this, flag, value]() { this->state_.set_flag(flag, value); });
+}
+
+SequenceStep EpsonProjector::send_string_command(QueryType type, std::string_view value,
+                                                 FixedString<STATE_CODE_LENGTH> ProjectorState::*member, bool force) {
+  if (this->skip_write(type, this->state_.*member == value, force)) {
+    return this->sequence_step();
+  }
+  std::string cmd_str = build_set_command(find_query_info(type)->cmd, value);
+  FixedString<STATE_CODE_LENGTH> code;
+  code = value;
+  return this->send_write(type, cmd_str, [this, member, code]() { this->state_.*member = code; });
+}
+
+SequenceStep EpsonProjector::set_power(bool on, bool force) {
+  if (!on) {
+    this->cancel_power_gated_writes();
+  }
+  bool unpowered = this->state_.power == PowerState::STANDBY || this->state_.power == PowerState::COOLDOWN;
+  if (this->skip_write(QueryType::POWER, on ? this->is_powered() : unpowered, force)) {
+    return this->sequence_step();
+  }
   std::string cmd = on ? build_power_on_command() : build_power_off_command();
-  this->send_command(cmd, CommandType::SET, [this, on](bool success, const std::string &) {
-    if (success) {
-      this->power_state_ = on ? PowerState::WARMUP : PowerState::COOLDOWN;
-      this->notify_state_change();
-    }
+  return this->send_write(QueryType::POWER, cmd, [this, on]() {
+    PowerState previous = this->state_.power;
+    this->state_.power = on ? PowerState::WARMUP : PowerState::COOLDOWN;
+    this->on_power_state_change(previous);
   });
 }
 
-void EpsonProjector::set_mute(bool mute) {
+SequenceStep EpsonProjector::set_mute(bool mute, bool force) {
+  if (this->skip_write(QueryType::MUTE, this->state_.has_flag(STATE_FLAG_MUTED) == mute, force)) {
+    return this->sequence_step();
+  }
   std::string cmd = build_mute_command(mute);
-  this->send_command(cmd, CommandType::SET, [this, mute](bool success, const std::string &) {
-    if (success) {
-      this->muted_ = mute;
-      this->notify_state_change();
-    }
-  });
+  return this->send_write(QueryType::MUTE, cmd, [this, mute]() { this->state_.set_flag(STATE_FLAG_MUTED, mute); });
 }
 
-void EpsonProjector::set_source(const std::string &source_code) {
+SequenceStep EpsonProjector::set_source(std::string_view source_code, bool force) {
   if (!is_valid_source_code(source_code)) {
-    ESP_LOGW(TAG, "Invalid source code: %s", source_code.c_str());
-    return;
+    ESP_LOGW(TAG, "Invalid source code: %.*s", static_cast<int>(source_code.size()), source_code.data());
+    return this->sequence_step(false);
   }
-  std::string cmd = build_set_command(CMD_SOURCE, source_code.c_str());
+  if (this->skip_write(QueryType::SOURCE, this->state_.source == source_code, force)) {
+    return this->sequence_step();
+  }
+  std::string cmd = build_set_command(CMD_SOURCE, source_code);
   if (cmd.empty()) {
-    return;
+    return this->sequence_step(false);
   }
-  this->send_command(cmd, CommandType::SET, [this, source_code](bool success, const std::string &) {
-    if (success) {
-      this->current_source_ = source_code;
-      this->notify_state_change();
-    }
-  });
+  FixedString<STATE_CODE_LENGTH> code;
+  code = source_code;
+  return this->send_write(QueryType::SOURCE, cmd, [this, code]() { this->state_.source = code; });
 }
 
-void EpsonProjector::set_volume(int volume) {
-  int clamped = clamp_value(volume, 0, VOLUME_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / VOLUME_MAX;
-  std::string cmd = build_set_command(CMD_VOLUME, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->volume_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_volume(int volume, bool force) {
+  return this->send_scaled_command<VOLUME_MAX>(QueryType::VOLUME, volume, &ProjectorState::volume, force);
 }
 
-void EpsonProjector::set_brightness(int brightness) {
-  int clamped = clamp_value(brightness, 0, BRIGHTNESS_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / BRIGHTNESS_MAX;
-  std::string cmd = build_set_command(CMD_BRIGHTNESS, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->brightness_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_brightness(int brightness, bool force) {
+  return this->send_scaled_command<BRIGHTNESS_MAX>(QueryType::BRIGHTNESS, brightness, &ProjectorState::brightness,
+                                                   force);
 }
 
-void EpsonProjector::set_contrast(int contrast) {
-  int clamped = clamp_value(contrast, 0, CONTRAST_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / CONTRAST_MAX;
-  std::string cmd = build_set_command(CMD_CONTRAST, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->contrast_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_contrast(int contrast, bool force) {
+  return this->send_scaled_command<CONTRAST_MAX>(QueryType::CONTRAST, contrast, &ProjectorState::contrast, force);
 }
 
-void EpsonProjector::set_color_mode(const std::string &mode_code) {
-  this->send_string_command(CMD_COLOR_MODE, mode_code, &EpsonProjector::current_color_mode_);
+SequenceStep EpsonProjector::set_color_mode(std::string_view mode_code, bool force) {
+  if (this->skip_write(QueryType::COLOR_MODE, this->state_.color_mode == mode_code, force)) {
+    return this->sequence_step();
+  }
+  std::string cmd_str = build_set_command(find_query_info(QueryType::COLOR_MODE)->cmd, mode_code);
+  FixedString<STATE_CODE_LENGTH> code;
+  code = mode_code;
+  return this->send_write(QueryType::COLOR_MODE, cmd_str, [this, code]() { this->apply_color_mode(code.view()); });
 }
 
-void EpsonProjector::set_aspect_ratio(const std::string &ratio_code) {
-  this->send_string_command(CMD_ASPECT, ratio_code, &EpsonProjector::current_aspect_ratio_);
+void EpsonProjector::apply_color_mode(std::string_view mode_code) {
+  bool changed = this->has_received(QueryType::COLOR_MODE) && this->state_.color_mode != mode_code;
+  this->state_.color_mode = mode_code;
+  if (!changed) {
+    return;
+  }
+  // Values read under the previous mode no longer hold, so they are neither trusted nor served from cache.
+  for (QueryType type : PICTURE_QUERIES) {
+    this->unconfirmed_queries_ |= query_bit(type);
+    if (this->has_query(type) && !this->query_support_.is_retired(type)) {
+      this->query(type);
+    }
+  }
 }
 
-void EpsonProjector::set_sharpness(int value) {
-  int clamped = clamp_value(value, 0, SHARPNESS_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / SHARPNESS_MAX;
-  std::string cmd = build_set_command(CMD_SHARPNESS, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->sharpness_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_aspect_ratio(std::string_view ratio_code, bool force) {
+  return this->send_string_command(QueryType::ASPECT_RATIO, ratio_code, &ProjectorState::aspect_ratio, force);
 }
 
-void EpsonProjector::set_density(int value) {
-  int clamped = clamp_value(value, 0, DENSITY_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / DENSITY_MAX;
-  std::string cmd = build_set_command(CMD_DENSITY, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->density_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_sharpness(int value, bool force) {
+  return this->send_scaled_command<SHARPNESS_MAX>(QueryType::SHARPNESS, value, &ProjectorState::sharpness, force);
 }
 
-void EpsonProjector::set_tint(int value) {
-  int clamped = clamp_value(value, 0, TINT_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / TINT_MAX;
-  std::string cmd = build_set_command(CMD_TINT, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->tint_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_density(int value, bool force) {
+  return this->send_scaled_command<DENSITY_MAX>(QueryType::DENSITY, value, &ProjectorState::density, force);
 }
 
-void EpsonProjector::set_color_temp(int value) {
-  int clamped = clamp_value(value, 0, COLOR_TEMP_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / COLOR_TEMP_MAX;
-  std::string cmd = build_set_command(CMD_COLOR_TEMP, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->color_temp_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_tint(int value, bool force) {
+  return this->send_scaled_command<TINT_MAX>(QueryType::TINT, value, &ProjectorState::tint, force);
 }
 
-void EpsonProjector::set_v_keystone(int value) {
-  int clamped = clamp_value(value, 0, KEYSTONE_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / KEYSTONE_MAX;
-  std::string cmd = build_set_command(CMD_VKEYSTONE, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->v_keystone_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_color_temp(int value, bool force) {
+  return this->send_scaled_command<COLOR_TEMP_MAX>(QueryType::COLOR_TEMP, value, &ProjectorState::color_temp, force);
 }
 
-void EpsonProjector::set_h_keystone(int value) {
-  int clamped = clamp_value(value, 0, KEYSTONE_MAX);
-  int projector_value = (clamped * PROJECTOR_RAW_MAX) / KEYSTONE_MAX;
-  std::string cmd = build_set_command(CMD_HKEYSTONE, projector_value);
-  this->send_command(cmd, CommandType::SET, [this, clamped](bool success, const std::string &) {
-    if (success) {
-      this->h_keystone_ = clamped;
-      this->notify_state_change();
-    }
-  });
+SequenceStep EpsonProjector::set_v_keystone(int value, bool force) {
+  return this->send_scaled_command<KEYSTONE_MAX>(QueryType::V_KEYSTONE, value, &ProjectorState::v_keystone, force);
 }
 
-void EpsonProjector::set_h_reverse(bool reverse) {
-  this->send_bool_command(CMD_HREVERSE, reverse, &EpsonProjector::h_reverse_);
+SequenceStep EpsonProjector::set_h_keystone(int value, bool force) {
+  return this->send_scaled_command<KEYSTONE_MAX>(QueryType::H_KEYSTONE, value, &ProjectorState::h_keystone, force);
 }
 
-void EpsonProjector::set_v_reverse(bool reverse) {
-  this->send_bool_command(CMD_VREVERSE, reverse, &EpsonProjector::v_reverse_);
+SequenceStep EpsonProjector::set_h_reverse(bool reverse, bool force) {
+  return this->send_bool_command(QueryType::H_REVERSE, reverse, STATE_FLAG_H_REVERSE, force);
 }
 
-void EpsonProjector::set_luminance(const std::string &mode_code) {
-  this->send_string_command(CMD_LUMINANCE, mode_code, &EpsonProjector::current_luminance_);
+SequenceStep EpsonProjector::set_v_reverse(bool reverse, bool force) {
+  return this->send_bool_command(QueryType::V_REVERSE, reverse, STATE_FLAG_V_REVERSE, force);
 }
 
-void EpsonProjector::set_gamma(const std::string &mode_code) {
-  this->send_string_command(CMD_GAMMA, mode_code, &EpsonProjector::current_gamma_);
+SequenceStep EpsonProjector::set_luminance(std::string_view mode_code, bool force) {
+  return this->send_string_command(QueryType::LUMINANCE, mode_code, &ProjectorState::luminance, force);
 }
 
-void EpsonProjector::set_freeze(bool freeze) {
-  this->send_bool_command(CMD_FREEZE, freeze, &EpsonProjector::frozen_);
+SequenceStep EpsonProjector::set_gamma(std::string_view mode_code, bool force) {
+  return this->send_string_command(QueryType::GAMMA, mode_code, &ProjectorState::gamma, force);
 }
 
-void EpsonProjector::query(QueryType type) {
+SequenceStep EpsonProjector::set_freeze(bool freeze, bool force) {
+  return this->send_bool_command(QueryType::FREEZE, freeze, STATE_FLAG_FROZEN, force);
+}
+
+SequenceStep EpsonProjector::query(QueryType type) {
   const QueryInfo *info = find_query_info(type);
   if (info == nullptr) {
     ESP_LOGW(TAG, "Unknown query type: %d", compat::to_underlying(type));
-    return;
+    return this->sequence_step(false);
+  }
+  bool queued = this->command_queue_.contains_if(
+      [info](const Command &cmd) { return cmd.type == CommandType::QUERY && cmd.info == info; });
+  // A sequence needs its own reply, so it does not piggyback on an already queued query.
+  if (queued && this->active_sequence_ == nullptr) {
+    return this->sequence_step();
   }
   std::string cmd = build_query_command(info->cmd);
-  this->send_command(cmd, CommandType::QUERY);
+  return this->send_command(cmd, CommandType::QUERY, nullptr, info);
 }
 
-void EpsonProjector::send_command(const std::string &cmd, CommandType type,
-                                  std::function<void(bool, const std::string &)> callback) {
-  Command command{cmd, type, std::move(callback), 0};
+SequenceStep EpsonProjector::send_command(const std::string &cmd, CommandType type,
+                                          std::function<void(bool, const std::string &)> callback,
+                                          const QueryInfo *info) {
+  if (this->passive_) {
+    ESP_LOGV(TAG, "Passive, not sending %s", info != nullptr ? info->cmd : "command");
+    if (callback) {
+      callback(false, "");
+    }
+    return this->sequence_step(false);
+  }
+  // A write cannot be acknowledged over a dead link, and each timeout would push the next probe further out.
+  if (type == CommandType::SET && this->link_monitor_.is_down()) {
+    ESP_LOGW(TAG, "Link down, not sending %s", info != nullptr ? info->cmd : "command");
+    if (callback) {
+      callback(false, "");
+    }
+    return this->sequence_step(false);
+  }
+  if (SequenceSlot *slot = this->active_sequence_; slot != nullptr) {
+    slot->pending++;
+    callback = [slot, callback = std::move(callback)](bool success, const std::string &response) {
+      slot->pending--;
+      if (!success) {
+        slot->failed = true;
+      }
+      if (callback) {
+        callback(success, response);
+      }
+    };
+  }
+  Command command{cmd, type, std::move(callback), 0, info};
   this->command_queue_.enqueue(std::move(command));
+  return this->sequence_step();
+}
+
+SequenceStep EpsonProjector::sequence_step(bool accepted) {
+  if (!accepted && this->active_sequence_ != nullptr) {
+    this->active_sequence_->failed = true;
+  }
+  return SequenceStep(this->active_sequence_);
+}
+
+PowerWait EpsonProjector::until(PowerState state, uint32_t timeout_ms) {
+  return PowerWait(this->active_sequence_, &this->state_.power, state, millis() + timeout_ms);
+}
+
+bool EpsonProjector::run(Sequence sequence) {
+  if (!sequence.valid()) {
+    ESP_LOGE(TAG, "Sequence not started: frame pool full or frame larger than %u bytes",
+             static_cast<unsigned>(SEQUENCE_FRAME_SIZE));
+    return false;
+  }
+  auto slot = std::ranges::find_if(this->sequences_, &SequenceSlot::idle);
+  if (slot == this->sequences_.end()) {
+    ESP_LOGE(TAG, "Sequence not started: %u already running", static_cast<unsigned>(MAX_SEQUENCES));
+    return false;
+  }
+  *slot = SequenceSlot{};
+  slot->handle = sequence.release();
+  return true;
+}
+
+void EpsonProjector::resume_sequences() {
+  uint32_t now = millis();
+  for (SequenceSlot &slot : this->sequences_) {
+    if (!slot.handle || slot.pending > 0) {
+      continue;
+    }
+    if (slot.awaiting_power && this->state_.power != slot.awaited_power &&
+        static_cast<int32_t>(now - slot.deadline) < 0) {
+      continue;
+    }
+    this->active_sequence_ = &slot;
+    slot.handle.resume();
+    this->active_sequence_ = nullptr;
+    if (slot.handle.done()) {
+      slot.handle.destroy();
+      slot.handle = nullptr;
+    }
+  }
 }
 
 void EpsonProjector::process_queue() {
   auto cmd_opt = this->command_queue_.dequeue();
+  while (cmd_opt.has_value() && this->is_power_gated(*cmd_opt)) {
+    ESP_LOGD(TAG, "Holding %s until the projector is on", cmd_opt->info->cmd);
+    this->command_queue_.defer(std::move(*cmd_opt));
+    cmd_opt = this->command_queue_.dequeue();
+  }
   if (!cmd_opt.has_value()) {
     return;
   }
 
   Command cmd = std::move(*cmd_opt);
   ESP_LOGV(TAG, "Sending: %s", cmd.command_str.c_str());
-  this->write_str(cmd.command_str.c_str());
+#ifdef USE_EPSON_PROJECTOR_WIRE_TRACE
+  this->wire_trace_.record(TraceDirection::TX, millis(), cmd.info, cmd.command_str);
+#endif
+  this->transport_->write_str(cmd.command_str.c_str());
   this->command_queue_.set_pending(std::move(cmd));
   this->last_command_time_ = millis();
 }
@@ -336,127 +1254,148 @@ void EpsonProjector::handle_response(const std::string &response) {
   if (!result) {
     ESP_LOGW(TAG, "Parse error: %s", result.error().c_str());
     auto &pending = this->command_queue_.pending_command();
+    this->record_query_result(pending, response, false);
     if (pending && pending->callback) {
       pending->callback(false, response);
     }
     this->command_queue_.clear_pending();
     return;
   }
-  ESP_LOGD(TAG, "Parsed response successfully");
+  ESP_LOGV(TAG, "Parsed response successfully");
+
+  this->apply_response(*result);
 
   auto &pending = this->command_queue_.pending_command();
+  this->record_query_result(pending, response, true);
+  if (pending && pending->callback) {
+    pending->callback(true, response);
+  }
+  this->command_queue_.clear_pending();
+}
 
+void EpsonProjector::apply_response(const ParseResult &result) {
   std::visit(
       [this](auto &&arg) {
         using T = std::decay_t<decltype(arg)>;
         if constexpr (std::is_same_v<T, PowerResponse>) {
-          ESP_LOGD(TAG, "Power state: %d -> %d", compat::to_underlying(this->power_state_),
+          ESP_LOGD(TAG, "Power state: %d -> %d", compat::to_underlying(this->state_.power),
                    compat::to_underlying(arg.state));
-          this->power_state_ = arg.state;
+          PowerState previous = this->state_.power;
+          this->state_.power = arg.state;
           this->mark_received(QueryType::POWER);
+          this->on_power_state_change(previous);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, LampResponse>) {
           ESP_LOGD(TAG, "Lamp hours: %u", arg.hours);
-          this->lamp_hours_ = arg.hours;
+          this->state_.lamp_hours = arg.hours;
           this->mark_received(QueryType::LAMP_HOURS);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, ErrorResponse>) {
-          this->error_code_ = arg.code;
+          this->state_.error_code = arg.code;
           this->mark_received(QueryType::ERROR_CODE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, SourceResponse>) {
           ESP_LOGD(TAG, "Source: %s", arg.source_code.c_str());
-          this->current_source_ = arg.source_code;
+          this->state_.source = arg.source_code;
           this->mark_received(QueryType::SOURCE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, MuteResponse>) {
           ESP_LOGD(TAG, "Mute: %s", arg.muted ? "ON" : "OFF");
-          this->muted_ = arg.muted;
+          this->state_.set_flag(STATE_FLAG_MUTED, arg.muted);
           this->mark_received(QueryType::MUTE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, VolumeResponse>) {
           ESP_LOGD(TAG, "Volume: %d", arg.value);
-          this->volume_ = arg.value;
+          this->state_.volume = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::VOLUME)] = arg.raw;
           this->mark_received(QueryType::VOLUME);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, BrightnessResponse>) {
           ESP_LOGD(TAG, "Brightness: %d", arg.value);
-          this->brightness_ = arg.value;
+          this->state_.brightness = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::BRIGHTNESS)] = arg.raw;
           this->mark_received(QueryType::BRIGHTNESS);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, ContrastResponse>) {
           ESP_LOGD(TAG, "Contrast: %d", arg.value);
-          this->contrast_ = arg.value;
+          this->state_.contrast = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::CONTRAST)] = arg.raw;
           this->mark_received(QueryType::CONTRAST);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, ColorModeResponse>) {
           ESP_LOGD(TAG, "Color mode: %s", arg.mode_code.c_str());
-          this->current_color_mode_ = arg.mode_code;
+          this->apply_color_mode(arg.mode_code);
           this->mark_received(QueryType::COLOR_MODE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, AspectRatioResponse>) {
           ESP_LOGD(TAG, "Aspect ratio: %s", arg.ratio_code.c_str());
-          this->current_aspect_ratio_ = arg.ratio_code;
+          this->state_.aspect_ratio = arg.ratio_code;
           this->mark_received(QueryType::ASPECT_RATIO);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, SharpnessResponse>) {
           ESP_LOGD(TAG, "Sharpness: %d", arg.value);
-          this->sharpness_ = arg.value;
+          this->state_.sharpness = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::SHARPNESS)] = arg.raw;
           this->mark_received(QueryType::SHARPNESS);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, DensityResponse>) {
           ESP_LOGD(TAG, "Density: %d", arg.value);
-          this->density_ = arg.value;
+          this->state_.density = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::DENSITY)] = arg.raw;
           this->mark_received(QueryType::DENSITY);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, TintResponse>) {
           ESP_LOGD(TAG, "Tint: %d", arg.value);
-          this->tint_ = arg.value;
+          this->state_.tint = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::TINT)] = arg.raw;
           this->mark_received(QueryType::TINT);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, ColorTempResponse>) {
           ESP_LOGD(TAG, "Color temperature: %d", arg.value);
-          this->color_temp_ = arg.value;
+          this->state_.color_temp = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::COLOR_TEMP)] = arg.raw;
           this->mark_received(QueryType::COLOR_TEMP);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, VKeystoneResponse>) {
           ESP_LOGD(TAG, "V Keystone: %d", arg.value);
-          this->v_keystone_ = arg.value;
+          this->state_.v_keystone = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::V_KEYSTONE)] = arg.raw;
           this->mark_received(QueryType::V_KEYSTONE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, HKeystoneResponse>) {
           ESP_LOGD(TAG, "H Keystone: %d", arg.value);
-          this->h_keystone_ = arg.value;
+          this->state_.h_keystone = to_byte(arg.value);
+          this->raw_values_[compat::to_underlying(QueryType::H_KEYSTONE)] = arg.raw;
           this->mark_received(QueryType::H_KEYSTONE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, HReverseResponse>) {
           ESP_LOGD(TAG, "H Reverse: %s", arg.reversed ? "ON" : "OFF");
-          this->h_reverse_ = arg.reversed;
+          this->state_.set_flag(STATE_FLAG_H_REVERSE, arg.reversed);
           this->mark_received(QueryType::H_REVERSE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, VReverseResponse>) {
           ESP_LOGD(TAG, "V Reverse: %s", arg.reversed ? "ON" : "OFF");
-          this->v_reverse_ = arg.reversed;
+          this->state_.set_flag(STATE_FLAG_V_REVERSE, arg.reversed);
           this->mark_received(QueryType::V_REVERSE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, LuminanceResponse>) {
           ESP_LOGD(TAG, "Luminance: %s", arg.mode_code.c_str());
-          this->current_luminance_ = arg.mode_code;
+          this->state_.luminance = arg.mode_code;
           this->mark_received(QueryType::LUMINANCE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, GammaResponse>) {
           ESP_LOGD(TAG, "Gamma: %s", arg.mode_code.c_str());
-          this->current_gamma_ = arg.mode_code;
+          this->state_.gamma = arg.mode_code;
           this->mark_received(QueryType::GAMMA);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, FreezeResponse>) {
           ESP_LOGD(TAG, "Freeze: %s", arg.frozen ? "ON" : "OFF");
-          this->frozen_ = arg.frozen;
+          this->state_.set_flag(STATE_FLAG_FROZEN, arg.frozen);
           this->mark_received(QueryType::FREEZE);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, SerialNumberResponse>) {
           ESP_LOGD(TAG, "Serial Number: %s", arg.serial.c_str());
-          this->serial_number_ = arg.serial;
+          this->state_.serial_number = arg.serial;
           this->mark_received(QueryType::SERIAL_NUMBER);
           this->notify_state_change();
         } else if constexpr (std::is_same_v<T, NumericResponse>) {
@@ -465,17 +1404,50 @@ void EpsonProjector::handle_response(const std::string &response) {
           ESP_LOGD(TAG, "Command acknowledged");
         }
       },
-      *result);
+      result);
+}
 
-  if (pending && pending->callback) {
-    pending->callback(true, response);
+void EpsonProjector::record_query_result(const std::optional<Command> &pending, const std::string &response,
+                                         bool success) {
+  if (!pending || pending->type != CommandType::QUERY || pending->info == nullptr) {
+    return;
+  }
+  QueryType type = pending->info->type;
+  if (success) {
+    this->query_support_.record_success(type);
+    return;
+  }
+  if (this->state_.power != PowerState::ON || !this->response_parser_.is_error_response(response)) {
+    return;
+  }
+  if (this->query_support_.record_error(type)) {
+    ESP_LOGW(TAG, "%s? rejected %u times in a row, no longer polling it", pending->info->cmd,
+             this->query_support_.error_threshold());
   }
-  this->command_queue_.clear_pending();
 }
 
 void EpsonProjector::notify_state_change() {
-  ESP_LOGV(TAG, "Notifying %d callbacks", this->state_callbacks_.size());
-  std::ranges::for_each(this->state_callbacks_, [](auto &cb) { cb(); });
+  if (this->restore_state_) {
+    this->state_dirty_ = true;
+  }
+  this->notify_pending_ = true;
+}
+
+void EpsonProjector::flush_notifications() {
+  if (!this->notify_pending_) {
+    return;
+  }
+  this->notify_pending_ = false;
+  for (StateListener *listener = this->listeners_; listener != nullptr; listener = listener->next_listener_) {
+    listener->on_state_change();
+  }
+}
+
+void EpsonProjector::record_loop_time(uint32_t start_us) {
+  uint32_t elapsed = micros() - start_us;
+  if (elapsed > this->max_loop_time_us_) {
+    this->max_loop_time_us_ = elapsed;
+  }
 }
 
 }  // namespace esphome::epson_projector
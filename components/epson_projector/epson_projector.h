@@ -1,138 +1,294 @@
 #pragma once
 
-#include "esphome/components/uart/uart.h"
 #include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
 
 #include "command.h"
 #include "command_queue.h"
+#include "command_tap.h"
 #include "cpp23_compat.h"
+#include "json_writer.h"
+#include "link_monitor.h"
+#include "loop_budget.h"
+#include "model_capabilities.h"
+#include "persisted_state.h"
+#include "picture_scene.h"
+#include "power_transition.h"
+#include "projector_state.h"
 #include "protocol_constants.h"
 #include "query_metadata.h"
+#include "query_support.h"
 #include "response_parser.h"
+#include "rx_framer.h"
+#include "sequence.h"
+#include "state_listener.h"
+#include "transport.h"
+#include "wire_trace.h"
 
+#include <array>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace esphome::epson_projector {
 
-class EpsonProjector : public uart::UARTDevice, public PollingComponent {
+class EpsonProjector : public PollingComponent {
  public:
+  ~EpsonProjector() override;
+
   void setup() override;
   void loop() override;
   void update() override;
   void dump_config() override;
+  void on_safe_shutdown() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
 
-  void set_power(bool on);
-  void set_mute(bool mute);
-  void set_source(const std::string &source_code);
-  void set_volume(int volume);
-  void set_brightness(int brightness);
-  void set_contrast(int contrast);
-  void set_color_mode(const std::string &mode_code);
-  void set_aspect_ratio(const std::string &ratio_code);
-  void set_sharpness(int value);
-  void set_density(int value);
-  void set_tint(int value);
-  void set_color_temp(int value);
-  void set_v_keystone(int value);
-  void set_h_keystone(int value);
-  void set_h_reverse(bool reverse);
-  void set_v_reverse(bool reverse);
-  void set_luminance(const std::string &mode_code);
-  void set_gamma(const std::string &mode_code);
-  void set_freeze(bool freeze);
-
-  void query(QueryType type);
-
-  [[nodiscard]] PowerState power_state() const { return power_state_; }
-  [[nodiscard]] bool is_muted() const { return muted_; }
-  [[nodiscard]] uint32_t lamp_hours() const { return lamp_hours_; }
-  [[nodiscard]] uint8_t error_code() const { return error_code_; }
-  [[nodiscard]] const std::string &current_source() const { return current_source_; }
-  [[nodiscard]] int volume() const { return volume_; }
-  [[nodiscard]] int brightness() const { return brightness_; }
-  [[nodiscard]] int contrast() const { return contrast_; }
-  [[nodiscard]] const std::string &current_color_mode() const { return current_color_mode_; }
-  [[nodiscard]] const std::string &current_aspect_ratio() const { return current_aspect_ratio_; }
-  [[nodiscard]] int sharpness() const { return sharpness_; }
-  [[nodiscard]] int density() const { return density_; }
-  [[nodiscard]] int tint() const { return tint_; }
-  [[nodiscard]] int color_temp() const { return color_temp_; }
-  [[nodiscard]] int v_keystone() const { return v_keystone_; }
-  [[nodiscard]] int h_keystone() const { return h_keystone_; }
-  [[nodiscard]] bool h_reverse() const { return h_reverse_; }
-  [[nodiscard]] bool v_reverse() const { return v_reverse_; }
-  [[nodiscard]] const std::string &current_luminance() const { return current_luminance_; }
-  [[nodiscard]] const std::string &current_gamma() const { return current_gamma_; }
-  [[nodiscard]] bool is_frozen() const { return frozen_; }
-  [[nodiscard]] const std::string &serial_number() const { return serial_number_; }
-
-  using StateCallback = std::function<void()>;
-  void add_on_state_callback(StateCallback callback) { state_callbacks_.push_back(std::move(callback)); }
-
-  void register_query(QueryType type) { registered_queries_ |= (1 << compat::to_underlying(type)); }
+  void set_transport(Transport *transport) { this->transport_ = transport; }
+  void set_restore_state(bool restore_state) { this->restore_state_ = restore_state; }
+  // Keys the saved state by hub ID so several hubs on one device keep separate flash slots.
+  void set_state_key(const std::string &hub_id) { this->state_key_ = fnv1_hash("epson_projector_state_" + hub_id); }
+  void set_loop_budget(uint32_t budget_us) { this->loop_budget_us_ = budget_us; }
+  void set_rx_bytes_per_loop(uint16_t bytes) { this->rx_bytes_per_loop_ = bytes; }
+  // Listen only: nothing is ever sent, and the traffic of another controller is decoded instead. The tap
+  // carries that controller's commands so replies and acknowledgements can be matched to them.
+  void set_passive(bool passive) { this->passive_ = passive; }
+  void set_command_tap(Transport *tap) { this->command_tap_transport_ = tap; }
+  [[nodiscard]] bool is_passive() const { return this->passive_; }
+  [[nodiscard]] uint32_t max_loop_time_us() const { return this->max_loop_time_us_; }
+  void set_model(const char *name, uint32_t unsupported_queries) {
+    this->model_name_ = name;
+    this->unsupported_queries_ = unsupported_queries;
+  }
+
+  SequenceStep set_power(bool on, bool force = false);
+  SequenceStep set_mute(bool mute, bool force = false);
+  SequenceStep set_source(std::string_view source_code, bool force = false);
+  SequenceStep set_volume(int volume, bool force = false);
+  SequenceStep set_brightness(int brightness, bool force = false);
+  SequenceStep set_contrast(int contrast, bool force = false);
+  SequenceStep set_color_mode(std::string_view mode_code, bool force = false);
+  SequenceStep set_aspect_ratio(std::string_view ratio_code, bool force = false);
+  SequenceStep set_sharpness(int value, bool force = false);
+  SequenceStep set_density(int value, bool force = false);
+  SequenceStep set_tint(int value, bool force = false);
+  SequenceStep set_color_temp(int value, bool force = false);
+  SequenceStep set_v_keystone(int value, bool force = false);
+  SequenceStep set_h_keystone(int value, bool force = false);
+  SequenceStep set_h_reverse(bool reverse, bool force = false);
+  SequenceStep set_v_reverse(bool reverse, bool force = false);
+  SequenceStep set_luminance(std::string_view mode_code, bool force = false);
+  SequenceStep set_gamma(std::string_view mode_code, bool force = false);
+  SequenceStep set_freeze(bool freeze, bool force = false);
+
+  SequenceStep query(QueryType type);
+  // Waits inside a sequence until the projector reports the given power state.
+  PowerWait until(PowerState state, uint32_t timeout_ms = SEQUENCE_UNTIL_TIMEOUT_MS);
+  // Starts a coroutine sequence (see sequence.h). Returns false if no slot is free.
+  bool run(Sequence sequence);
+  void dump_wire_trace();
+  // Appends the whole cached state, link health and confirmation times to `out` as one JSON object.
+  void write_snapshot(std::string &out) const;
+  // Queues a raw ESC/VP21 command line from a bridge client. `reply` receives the projector's reply frame,
+  // or an empty string if none arrived. Returns false if the line holds no command.
+  bool forward(const std::string &line, std::function<void(bool, const std::string &)> reply);
+  // Sets `out` to the reply the projector would give to a query, if it confirmed the value within max_age_ms.
+  bool cached_reply(QueryType type, uint32_t max_age_ms, std::string &out) const;
+
+  void add_scene(PictureScene scene) { this->scenes_.push_back(std::move(scene)); }
+  bool apply_scene(const std::string &name);
+  using SceneCallback = std::function<void(const std::string &, bool)>;
+  void add_on_scene_applied_callback(SceneCallback callback) { scene_callbacks_.push_back(std::move(callback)); }
+
+  void set_link_down_threshold(uint8_t threshold) { this->link_monitor_.set_down_threshold(threshold); }
+  [[nodiscard]] LinkState link_state() const { return this->link_monitor_.state(); }
+  [[nodiscard]] bool is_link_up() const { return this->link_state() != LinkState::DOWN; }
+
+  [[nodiscard]] PowerState power_state() const { return this->state_.power; }
+  [[nodiscard]] bool is_powered() const {
+    return this->state_.power == PowerState::ON || this->state_.power == PowerState::WARMUP;
+  }
+  [[nodiscard]] bool is_muted() const { return this->state_.has_flag(STATE_FLAG_MUTED); }
+  [[nodiscard]] uint32_t lamp_hours() const { return this->state_.lamp_hours; }
+  [[nodiscard]] uint8_t error_code() const { return this->state_.error_code; }
+  [[nodiscard]] std::string_view current_source() const { return this->state_.source.view(); }
+  [[nodiscard]] int volume() const { return this->state_.volume; }
+  [[nodiscard]] int brightness() const { return this->state_.brightness; }
+  [[nodiscard]] int contrast() const { return this->state_.contrast; }
+  [[nodiscard]] std::string_view current_color_mode() const { return this->state_.color_mode.view(); }
+  [[nodiscard]] std::string_view current_aspect_ratio() const { return this->state_.aspect_ratio.view(); }
+  [[nodiscard]] int sharpness() const { return this->state_.sharpness; }
+  [[nodiscard]] int density() const { return this->state_.density; }
+  [[nodiscard]] int tint() const { return this->state_.tint; }
+  [[nodiscard]] int color_temp() const { return this->state_.color_temp; }
+  [[nodiscard]] int v_keystone() const { return this->state_.v_keystone; }
+  [[nodiscard]] int h_keystone() const { return this->state_.h_keystone; }
+  [[nodiscard]] bool h_reverse() const { return this->state_.has_flag(STATE_FLAG_H_REVERSE); }
+  [[nodiscard]] bool v_reverse() const { return this->state_.has_flag(STATE_FLAG_V_REVERSE); }
+  [[nodiscard]] std::string_view current_luminance() const { return this->state_.luminance.view(); }
+  [[nodiscard]] std::string_view current_gamma() const { return this->state_.gamma.view(); }
+  [[nodiscard]] bool is_frozen() const { return this->state_.has_flag(STATE_FLAG_FROZEN); }
+  [[nodiscard]] std::string_view serial_number() const { return this->state_.serial_number.view(); }
+  [[nodiscard]] const ProjectorState &state() const { return this->state_; }
+
+  void add_listener(StateListener *listener);
+
+  void register_query(QueryType type) {
+    if (this->supports(type)) {
+      registered_queries_ |= query_bit(type);
+    }
+  }
+  [[nodiscard]] bool supports(QueryType type) const {
+    return query_compiled_in(type) && (this->unsupported_queries_ & query_bit(type)) == 0;
+  }
   [[nodiscard]] bool has_query(QueryType type) const {
-    return (registered_queries_ & (1 << compat::to_underlying(type))) != 0;
+    return this->supports(type) && (registered_queries_ & query_bit(type)) != 0;
   }
 
-  void mark_received(QueryType type) { received_queries_ |= (1 << compat::to_underlying(type)); }
+  void mark_received(QueryType type) {
+    received_queries_ |= (1 << compat::to_underlying(type));
+    unconfirmed_queries_ &= ~(1 << compat::to_underlying(type));
+    this->confirmed_at_[compat::to_underlying(type)] = millis();
+  }
   [[nodiscard]] bool has_received(QueryType type) const {
     return (received_queries_ & (1 << compat::to_underlying(type))) != 0;
   }
+  [[nodiscard]] bool is_confirmed(QueryType type) const {
+    return this->has_received(type) && (unconfirmed_queries_ & (1 << compat::to_underlying(type))) == 0;
+  }
+  [[nodiscard]] bool is_fresh(QueryType type, uint32_t max_age_ms) const {
+    return this->is_confirmed(type) && millis() - this->confirmed_at_[compat::to_underlying(type)] <= max_age_ms;
+  }
+  [[nodiscard]] bool has_pending_write(QueryType type) const {
+    return pending_writes_[compat::to_underlying(type)] > 0;
+  }
 
  protected:
-  void send_command(const std::string &cmd, CommandType type,
-                    std::function<void(bool, const std::string &)> callback = nullptr);
+  SequenceStep send_command(const std::string &cmd, CommandType type,
+                            std::function<void(bool, const std::string &)> callback = nullptr,
+                            const QueryInfo *info = nullptr);
+  SequenceStep sequence_step(bool accepted = true);
+  void resume_sequences();
+  void attach_to_scheduler();
+  void detach_from_scheduler();
+  void run_scheduled_links();
+  void service_link(uint32_t start_us, uint32_t budget_us);
+  bool read_responses(LoopBudget &budget, bool single_frame = false);
+  void read_tapped_traffic(LoopBudget &budget);
+  bool read_tapped_command(LoopBudget &budget);
+  void observe_command(const std::string &line);
+  void apply_observed_write(const QueryInfo &info, const std::string &value);
+  void run_scheduler();
   void process_queue();
   void handle_response(const std::string &response);
+  void apply_response(const ParseResult &result);
+  void handle_timeout(uint32_t now);
+  void handle_resync();
+  bool is_awaiting_ack() const;
+  void record_link_activity();
+  void on_link_state_change(LinkState previous);
+  void on_power_state_change(PowerState previous);
+  void apply_color_mode(std::string_view mode_code);
+  void record_query_result(const std::optional<Command> &pending, const std::string &response, bool success);
+  void queue_refresh_burst();
   void notify_state_change();
-  std::string format_response_for_log(const std::string &response);
+  void flush_notifications();
+  void record_loop_time(uint32_t start_us);
+  void load_state();
+  void save_state(bool force);
+  PersistedState capture_state() const;
+  void apply_state(const PersistedState &state);
   bool is_busy_state() const;
+  void write_query_value(JsonWriter &writer, QueryType type) const;
+  bool append_wire_value(std::string &out, QueryType type) const;
+  bool is_power_gated(const Command &cmd) const;
+  void cancel_power_gated_writes();
+
+  struct SceneBatch {
+    std::string name;
+    uint8_t remaining{0};
+    bool failed{false};
+  };
+  PictureScene current_picture() const;
+  void write_scene_field(const PictureScene &scene, SceneField field);
+  void complete_batch_step(const std::shared_ptr<SceneBatch> &batch, bool success);
 
-  void send_int_command(const char *cmd, int min_val, int max_val, int value, int EpsonProjector::*member);
-  void send_bool_command(const char *cmd, bool value, bool EpsonProjector::*member);
-  void send_string_command(const char *cmd, const std::string &value, std::string EpsonProjector::*member);
+  SequenceStep send_write(QueryType type, const std::string &cmd, std::function<void()> apply);
+  bool skip_write(QueryType type, bool matches, bool force);
+  template <int UiMax>
+  SequenceStep send_scaled_command(QueryType type, int value, uint8_t ProjectorState::*member, bool force);
+  SequenceStep send_bool_command(QueryType type, bool value, StateFlag flag, bool force);
+  SequenceStep send_string_command(QueryType type, std::string_view value,
+                                   FixedString<STATE_CODE_LENGTH> ProjectorState::*member, bool force);
 
+  Transport *transport_{nullptr};
   CommandQueue command_queue_;
   ResponseParser response_parser_;
-  std::string rx_buffer_;
-
-  PowerState power_state_{PowerState::UNKNOWN};
-  bool muted_{false};
-  uint32_t lamp_hours_{0};
-  uint8_t error_code_{0};
-  std::string current_source_;
-  std::string current_color_mode_;
-  std::string current_aspect_ratio_;
-  int volume_{0};
-  int brightness_{0};
-  int contrast_{0};
-  int sharpness_{0};
-  int density_{0};
-  int tint_{0};
-  int color_temp_{0};
-  int v_keystone_{0};
-  int h_keystone_{0};
-  bool h_reverse_{false};
-  bool v_reverse_{false};
-  std::string current_luminance_;
-  std::string current_gamma_;
-  bool frozen_{false};
-  std::string serial_number_;
+  LinkMonitor link_monitor_;
+  QuerySupport query_support_;
+  RxFramer rx_framer_;
+  Transport *command_tap_transport_{nullptr};
+  CommandTap command_tap_;
+  bool passive_{false};
+#ifdef USE_EPSON_PROJECTOR_WIRE_TRACE
+  WireTrace<USE_EPSON_PROJECTOR_WIRE_TRACE> wire_trace_;
+#endif
+
+  ProjectorState state_;
 
   uint32_t last_command_time_{0};
   static constexpr uint32_t COMMAND_DELAY_MS = 500;
   static constexpr uint32_t INITIAL_QUERY_DELAY_MS = 50;
   static constexpr uint32_t RESPONSE_TIMEOUT_MS = 3000;
   static constexpr uint32_t BUSY_TIMEOUT_MS = 10000;
+  static constexpr uint32_t TRANSITION_POLL_INTERVAL_MS = 2000;
 
-  std::vector<StateCallback> state_callbacks_;
+  uint32_t last_power_poll_time_{0};
+  bool refresh_burst_{false};
+
+  uint32_t loop_budget_us_{2000};
+  uint32_t max_loop_time_us_{0};
+  uint16_t rx_bytes_per_loop_{64};
+  bool notify_pending_{false};
+
+  StateListener *listeners_{nullptr};
+  const char *model_name_{MODEL_NAME};
+  uint32_t unsupported_queries_{0};
   uint32_t registered_queries_{0};
   uint32_t received_queries_{0};
+  uint32_t unconfirmed_queries_{0};
+  std::array<uint8_t, std::size(QUERY_TABLE)> pending_writes_{};
+  std::array<uint32_t, std::size(QUERY_TABLE)> confirmed_at_{};
+  std::array<uint8_t, std::size(QUERY_TABLE)> raw_values_{};
   bool initial_query_done_{false};
+
+  std::vector<PictureScene> scenes_;
+  std::vector<SceneCallback> scene_callbacks_;
+  std::shared_ptr<SceneBatch> active_batch_;
+
+  static constexpr size_t MAX_SEQUENCES = 2;
+  static constexpr uint32_t SEQUENCE_UNTIL_TIMEOUT_MS = 90000;
+  std::array<SequenceSlot, MAX_SEQUENCES> sequences_{};
+  SequenceSlot *active_sequence_{nullptr};
+
+  ESPPreferenceObject state_pref_;
+  uint32_t state_key_{fnv1_hash("epson_projector_state")};
+  PersistedState last_saved_state_{};
+  uint32_t last_save_time_{0};
+  bool restore_state_{true};
+  bool state_dirty_{false};
+  bool publish_restored_{false};
+  static constexpr uint32_t STATE_SAVE_INTERVAL_MS = 300000;
+
+  // All instances form a ring driven from the first one's loop(), so N projectors cost one scan.
+  EpsonProjector *next_link_{nullptr};
+  static inline EpsonProjector *first_link_{nullptr};
+  static inline EpsonProjector *next_serviced_{nullptr};
 };
 
 }  // namespace esphome::epson_projector
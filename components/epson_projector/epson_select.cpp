@@ -7,99 +7,41 @@ namespace esphome::epson_projector {
 
 static const char *const TAG = "epson_projector.select";
 
-void EpsonSelect::set_options_map(const std::map<std::string, std::string> &options_map) {
-  for (const auto &[name, code] : options_map) {
-    this->add_option(name, code);
-  }
-}
-
-void EpsonSelect::add_option(const std::string &name, const std::string &code) {
-  this->options_map_[name] = code;
-  this->reverse_map_[code] = name;
-  this->option_names_.push_back(name);
-}
-
-void EpsonSelect::setup() {
+void EpsonSelectBase::setup() {
   if (!setup_entity(this, TAG)) {
     return;
   }
 
-  const auto *info = find_select_type_info(this->select_type_);
-  if (info != nullptr) {
-    this->parent_->register_query(info->query_type);
-  }
+  this->parent_->register_query(this->info_->query_type);
 
-  if (!this->option_names_.empty()) {
+  if (!this->options_.empty()) {
     FixedVector<const char *> option_ptrs;
-    option_ptrs.init(this->option_names_.size());
-    for (const auto &name : this->option_names_) {
-      option_ptrs.push_back(name.c_str());
+    option_ptrs.init(this->options_.size());
+    for (size_t i = 0; i < this->options_.size(); i++) {
+      option_ptrs.push_back(this->options_.name(i));
     }
     this->traits.set_options(option_ptrs);
   }
 }
 
-void EpsonSelect::dump_config() {
+void EpsonSelectBase::dump_config() {
   LOG_SELECT("", "Epson Projector Select", this);
-  const auto *info = find_select_type_info(this->select_type_);
-  ESP_LOGCONFIG(TAG, "  Type: %s", info != nullptr ? info->name : "Unknown");
+  ESP_LOGCONFIG(TAG, "  Type: %s", this->info_->name);
 }
 
-void EpsonSelect::control(const std::string &value) {
-  auto it = this->options_map_.find(value);
-  if (it == this->options_map_.end()) {
-    ESP_LOGW(TAG, "Unknown option: %s", value.c_str());
-    return;
+const char *EpsonSelectBase::find_code(const std::string &name) const {
+  auto index = this->options_.index_of_name(name);
+  if (!index.has_value()) {
+    ESP_LOGW(TAG, "Unknown option: %s", name.c_str());
+    return nullptr;
   }
-
-  const std::string &code = it->second;
-  switch (this->select_type_) {
-    case SelectType::SOURCE:
-      this->parent_->set_source(code);
-      break;
-    case SelectType::COLOR_MODE:
-      this->parent_->set_color_mode(code);
-      break;
-    case SelectType::ASPECT_RATIO:
-      this->parent_->set_aspect_ratio(code);
-      break;
-    case SelectType::LUMINANCE:
-      this->parent_->set_luminance(code);
-      break;
-    case SelectType::GAMMA:
-      this->parent_->set_gamma(code);
-      break;
-  }
-  this->publish_state(value);
+  return this->options_.code(*index);
 }
 
-void EpsonSelect::on_state_change() {
-  const auto *info = find_select_type_info(this->select_type_);
-  if (info == nullptr || !this->parent_->has_received(info->query_type)) {
-    return;
-  }
-  std::string current;
-  switch (this->select_type_) {
-    case SelectType::SOURCE:
-      current = this->parent_->current_source();
-      break;
-    case SelectType::COLOR_MODE:
-      current = this->parent_->current_color_mode();
-      break;
-    case SelectType::ASPECT_RATIO:
-      current = this->parent_->current_aspect_ratio();
-      break;
-    case SelectType::LUMINANCE:
-      current = this->parent_->current_luminance();
-      break;
-    case SelectType::GAMMA:
-      current = this->parent_->current_gamma();
-      break;
-  }
-
-  auto it = this->reverse_map_.find(current);
-  if (it != this->reverse_map_.end()) {
-    this->publish_state(it->second);
+void EpsonSelectBase::publish_code(std::string_view code) {
+  auto index = this->options_.index_of_code(code);
+  if (index.has_value()) {
+    this->publish_state(*index);
   }
 }
 
@@ -6,31 +6,82 @@
 #include "entity_base.h"
 #include "entity_metadata.h"
 #include "epson_projector.h"
+#include "select_options.h"
 
-#include <map>
 #include <string>
-#include <vector>
+#include <string_view>
 
 namespace esphome::epson_projector {
 
-class EpsonSelect : public select::Select, public Component, public Parented<EpsonProjector> {
+struct SelectAccessors {
+  std::string_view (EpsonProjector::*get)() const;
+  SequenceStep (EpsonProjector::*set)(std::string_view, bool);
+};
+
+constexpr SelectAccessors select_accessors(SelectType type) {
+  switch (type) {
+    case SelectType::SOURCE:
+      return {&EpsonProjector::current_source, &EpsonProjector::set_source};
+    case SelectType::COLOR_MODE:
+      return {&EpsonProjector::current_color_mode, &EpsonProjector::set_color_mode};
+    case SelectType::ASPECT_RATIO:
+      return {&EpsonProjector::current_aspect_ratio, &EpsonProjector::set_aspect_ratio};
+    case SelectType::LUMINANCE:
+      return {&EpsonProjector::current_luminance, &EpsonProjector::set_luminance};
+    case SelectType::GAMMA:
+      return {&EpsonProjector::current_gamma, &EpsonProjector::set_gamma};
+  }
+  return {nullptr, nullptr};
+}
+
+class EpsonSelectBase : public select::Select,
+                        public Component,
+                        public Parented<EpsonProjector>,
+                        public StateListener {
  public:
+  explicit EpsonSelectBase(const SelectTypeInfo *info) : info_(info) {}
+
   void setup() override;
   void dump_config() override;
 
-  void set_select_type(SelectType type) { this->select_type_ = type; }
-  void set_options_map(const std::map<std::string, std::string> &options_map);
-  void add_option(const std::string &name, const std::string &code);
-
-  void on_state_change();
+  void set_options(const SelectOption *options, const uint8_t *by_code, size_t size) {
+    this->options_ = SelectOptionTable(options, by_code, size);
+  }
 
  protected:
-  void control(const std::string &value) override;
+  const char *find_code(const std::string &name) const;
+  void publish_code(std::string_view code);
+
+  const SelectTypeInfo *info_;
+  SelectOptionTable options_;
+};
+
+template <SelectType Type>
+class EpsonSelect : public EpsonSelectBase {
+  static constexpr const SelectTypeInfo *INFO = find_select_type_info(Type);
+  static_assert(INFO != nullptr, "Every select type needs a SELECT_TYPE_INFO entry");
+  static constexpr SelectAccessors ACCESSORS = select_accessors(Type);
+  static_assert(ACCESSORS.get != nullptr, "Every select type needs hub accessors");
+
+ public:
+  EpsonSelect() : EpsonSelectBase(INFO) {}
+
+  void on_state_change() override {
+    if (!this->parent_->has_received(INFO->query_type) || this->parent_->has_pending_write(INFO->query_type)) {
+      return;
+    }
+    this->publish_code((this->parent_->*ACCESSORS.get)());
+  }
 
-  SelectType select_type_{SelectType::SOURCE};
-  std::map<std::string, std::string> options_map_;
-  std::map<std::string, std::string> reverse_map_;
-  std::vector<std::string> option_names_;
+ protected:
+  void control(const std::string &value) override {
+    const char *code = this->find_code(value);
+    if (code == nullptr) {
+      return;
+    }
+    (this->parent_->*ACCESSORS.set)(code, false);
+    this->publish_state(value);
+  }
 };
 
 }  // namespace esphome::epson_projector
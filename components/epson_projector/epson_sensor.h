@@ -9,17 +9,39 @@
 
 namespace esphome::epson_projector {
 
-class EpsonSensor : public sensor::Sensor, public Component, public Parented<EpsonProjector> {
+class EpsonSensorBase : public sensor::Sensor,
+                        public Component,
+                        public Parented<EpsonProjector>,
+                        public StateListener {
  public:
+  explicit EpsonSensorBase(const SensorTypeInfo *info) : info_(info) {}
+
   void setup() override;
   void dump_config() override;
 
-  void set_sensor_type(SensorType type) { this->sensor_type_ = type; }
+ protected:
+  const SensorTypeInfo *info_;
+};
 
-  void on_state_change();
+template <SensorType Type>
+class EpsonSensor : public EpsonSensorBase {
+  static constexpr const SensorTypeInfo *INFO = find_sensor_type_info(Type);
+  static_assert(INFO != nullptr, "Every sensor type needs a SENSOR_TYPE_INFO entry");
 
- protected:
-  SensorType sensor_type_{SensorType::LAMP_HOURS};
+ public:
+  EpsonSensor() : EpsonSensorBase(INFO) {}
+
+  void on_state_change() override {
+    if (!this->parent_->has_received(INFO->query_type)) {
+      return;
+    }
+    if constexpr (Type == SensorType::LAMP_HOURS) {
+      this->publish_state(static_cast<float>(this->parent_->lamp_hours()));
+    } else {
+      static_assert(Type == SensorType::ERROR_CODE);
+      this->publish_state(static_cast<float>(this->parent_->error_code()));
+    }
+  }
 };
 
 }  // namespace esphome::epson_projector
@@ -9,19 +9,63 @@
 
 namespace esphome::epson_projector {
 
-class EpsonSwitch : public switch_::Switch, public Component, public Parented<EpsonProjector> {
+struct SwitchAccessors {
+  bool (EpsonProjector::*get)() const;
+  SequenceStep (EpsonProjector::*set)(bool, bool);
+};
+
+constexpr SwitchAccessors switch_accessors(SwitchType type) {
+  switch (type) {
+    case SwitchType::POWER:
+      return {&EpsonProjector::is_powered, &EpsonProjector::set_power};
+    case SwitchType::MUTE:
+      return {&EpsonProjector::is_muted, &EpsonProjector::set_mute};
+    case SwitchType::H_REVERSE:
+      return {&EpsonProjector::h_reverse, &EpsonProjector::set_h_reverse};
+    case SwitchType::V_REVERSE:
+      return {&EpsonProjector::v_reverse, &EpsonProjector::set_v_reverse};
+    case SwitchType::FREEZE:
+      return {&EpsonProjector::is_frozen, &EpsonProjector::set_freeze};
+  }
+  return {nullptr, nullptr};
+}
+
+class EpsonSwitchBase : public switch_::Switch,
+                        public Component,
+                        public Parented<EpsonProjector>,
+                        public StateListener {
  public:
+  explicit EpsonSwitchBase(const SwitchTypeInfo *info) : info_(info) {}
+
   void setup() override;
   void dump_config() override;
 
-  void set_switch_type(SwitchType type) { this->switch_type_ = type; }
+ protected:
+  const SwitchTypeInfo *info_;
+};
+
+template <SwitchType Type>
+class EpsonSwitch : public EpsonSwitchBase {
+  static constexpr const SwitchTypeInfo *INFO = find_switch_type_info(Type);
+  static_assert(INFO != nullptr, "Every switch type needs a SWITCH_TYPE_INFO entry");
+  static constexpr SwitchAccessors ACCESSORS = switch_accessors(Type);
+  static_assert(ACCESSORS.get != nullptr, "Every switch type needs hub accessors");
 
-  void on_state_change();
+ public:
+  EpsonSwitch() : EpsonSwitchBase(INFO) {}
 
- protected:
-  void write_state(bool state) override;
+  void on_state_change() override {
+    if (!this->parent_->has_received(INFO->query_type) || this->parent_->has_pending_write(INFO->query_type)) {
+      return;
+    }
+    this->publish_state((this->parent_->*ACCESSORS.get)());
+  }
 
-  SwitchType switch_type_{SwitchType::POWER};
+ protected:
+  void write_state(bool state) override {
+    (this->parent_->*ACCESSORS.set)(state, false);
+    this->publish_state(state);
+  }
 };
 
 }  // namespace esphome::epson_projector
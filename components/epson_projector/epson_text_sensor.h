@@ -7,19 +7,42 @@
 #include "entity_metadata.h"
 #include "epson_projector.h"
 
+#include <string>
+
 namespace esphome::epson_projector {
 
-class EpsonTextSensor : public text_sensor::TextSensor, public Component, public Parented<EpsonProjector> {
+class EpsonTextSensorBase : public text_sensor::TextSensor,
+                            public Component,
+                            public Parented<EpsonProjector>,
+                            public StateListener {
  public:
+  explicit EpsonTextSensorBase(const TextSensorTypeInfo *info) : info_(info) {}
+
   void setup() override;
   void dump_config() override;
 
-  void set_text_sensor_type(TextSensorType type) { this->sensor_type_ = type; }
+ protected:
+  const TextSensorTypeInfo *info_;
+};
 
-  void on_state_change();
+template <TextSensorType Type>
+class EpsonTextSensor : public EpsonTextSensorBase {
+  static constexpr const TextSensorTypeInfo *INFO = find_text_sensor_type_info(Type);
+  static_assert(INFO != nullptr, "Every text sensor type needs a TEXT_SENSOR_TYPE_INFO entry");
+  static_assert(Type == TextSensorType::SERIAL_NUMBER);
 
- protected:
-  TextSensorType sensor_type_{TextSensorType::SERIAL_NUMBER};
+ public:
+  EpsonTextSensor() : EpsonTextSensorBase(INFO) {}
+
+  void on_state_change() override {
+    if (!this->parent_->has_received(INFO->query_type)) {
+      return;
+    }
+    auto value = this->parent_->serial_number();
+    if (!value.empty()) {
+      this->publish_state(std::string(value));
+    }
+  }
 };
 
 }  // namespace esphome::epson_projector
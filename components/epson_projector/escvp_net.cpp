@@ -0,0 +1,63 @@
+#include "escvp_net.h"
+
+#include <cstring>
+
+namespace esphome::epson_projector {
+
+namespace {
+
+constexpr char ESCVP_NET_MAGIC[] = "ESC/VP.net";
+constexpr size_t ESCVP_NET_MAGIC_SIZE = sizeof(ESCVP_NET_MAGIC) - 1;
+
+constexpr size_t OFFSET_VERSION = 10;
+constexpr size_t OFFSET_TYPE = 11;
+constexpr size_t OFFSET_STATUS = 14;
+constexpr size_t OFFSET_FIELD_COUNT = 15;
+
+}  // namespace
+
+std::array<uint8_t, ESCVP_NET_HEADER_SIZE> build_escvp_net_connect() {
+  std::array<uint8_t, ESCVP_NET_HEADER_SIZE> packet{};
+  std::memcpy(packet.data(), ESCVP_NET_MAGIC, ESCVP_NET_MAGIC_SIZE);
+  packet[OFFSET_VERSION] = ESCVP_NET_VERSION;
+  packet[OFFSET_TYPE] = ESCVP_NET_TYPE_CONNECT;
+  return packet;
+}
+
+EscvpNetReply parse_escvp_net_reply(const uint8_t *data, size_t len) {
+  if (len < ESCVP_NET_HEADER_SIZE) {
+    return {HandshakeResult::INCOMPLETE, 0, 0};
+  }
+  if (std::memcmp(data, ESCVP_NET_MAGIC, ESCVP_NET_MAGIC_SIZE) != 0 || data[OFFSET_TYPE] != ESCVP_NET_TYPE_CONNECT) {
+    return {HandshakeResult::INVALID, 0, 0};
+  }
+  uint8_t status = data[OFFSET_STATUS];
+  uint8_t field_count = data[OFFSET_FIELD_COUNT];
+  if (status != ESCVP_NET_STATUS_OK) {
+    return {HandshakeResult::REJECTED, status, field_count};
+  }
+  return {HandshakeResult::ACCEPTED, status, field_count};
+}
+
+const char *escvp_net_status_to_string(uint8_t status) {
+  switch (status) {
+    case 0x20:
+      return "OK";
+    case 0x40:
+      return "Bad request";
+    case 0x41:
+      return "Password required";
+    case 0x43:
+      return "Forbidden";
+    case 0x45:
+      return "Request not allowed";
+    case 0x53:
+      return "Service unavailable";
+    case 0x55:
+      return "Protocol version not supported";
+    default:
+      return "Unknown status";
+  }
+}
+
+}  // namespace esphome::epson_projector
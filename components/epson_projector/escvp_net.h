@@ -0,0 +1,34 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome::epson_projector {
+
+static constexpr uint16_t ESCVP_NET_PORT = 3629;
+static constexpr size_t ESCVP_NET_HEADER_SIZE = 16;
+static constexpr size_t ESCVP_NET_FIELD_SIZE = 18;
+
+static constexpr uint8_t ESCVP_NET_VERSION = 0x10;
+static constexpr uint8_t ESCVP_NET_TYPE_CONNECT = 0x03;
+static constexpr uint8_t ESCVP_NET_STATUS_OK = 0x20;
+
+enum class HandshakeResult : uint8_t {
+  INCOMPLETE,
+  ACCEPTED,
+  REJECTED,
+  INVALID,
+};
+
+struct EscvpNetReply {
+  HandshakeResult result;
+  uint8_t status;
+  uint8_t field_count;
+};
+
+std::array<uint8_t, ESCVP_NET_HEADER_SIZE> build_escvp_net_connect();
+EscvpNetReply parse_escvp_net_reply(const uint8_t *data, size_t len);
+const char *escvp_net_status_to_string(uint8_t status);
+
+}  // namespace esphome::epson_projector
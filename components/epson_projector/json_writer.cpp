@@ -0,0 +1,63 @@
+#include "json_writer.h"
+
+#include <charconv>
+
+namespace esphome::epson_projector {
+
+void JsonWriter::separate() {
+  if (!this->first_) {
+    this->out_ += ',';
+  }
+  this->first_ = false;
+}
+
+void JsonWriter::begin_object() {
+  this->separate();
+  this->out_ += '{';
+  this->first_ = true;
+}
+
+void JsonWriter::end_object() {
+  this->out_ += '}';
+  this->first_ = false;
+}
+
+void JsonWriter::key(std::string_view name) {
+  this->string(name);
+  this->out_ += ':';
+  this->first_ = true;
+}
+
+void JsonWriter::string(std::string_view text) {
+  static constexpr char HEX[] = "0123456789abcdef";
+  this->separate();
+  this->out_ += '"';
+  for (char c : text) {
+    auto byte = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\') {
+      this->out_ += '\\';
+      this->out_ += c;
+    } else if (byte < 0x20) {
+      this->out_ += "\\u00";
+      this->out_ += HEX[byte >> 4];
+      this->out_ += HEX[byte & 0x0F];
+    } else {
+      this->out_ += c;
+    }
+  }
+  this->out_ += '"';
+}
+
+void JsonWriter::number(int64_t value) {
+  char digits[24];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  this->separate();
+  this->out_.append(digits, result.ptr);
+}
+
+void JsonWriter::boolean(bool value) {
+  this->separate();
+  this->out_ += value ? "true" : "false";
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace esphome::epson_projector {
+
+// Appends compact JSON to a caller-owned string. A buffer that is cleared and reused stops allocating
+// once it has grown to the largest document.
+class JsonWriter {
+ public:
+  explicit JsonWriter(std::string &out) : out_(out) {}
+
+  void begin_object();
+  void end_object();
+  void key(std::string_view name);
+  void string(std::string_view text);
+  void number(int64_t value);
+  void boolean(bool value);
+
+ private:
+  void separate();
+
+  std::string &out_;
+  bool first_{true};
+};
+
+}  // namespace esphome::epson_projector
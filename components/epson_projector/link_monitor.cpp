@@ -0,0 +1,57 @@
+#include "link_monitor.h"
+
+#include <algorithm>
+
+namespace esphome::epson_projector {
+
+const char *link_state_to_string(LinkState state) {
+  switch (state) {
+    case LinkState::UP:
+      return "UP";
+    case LinkState::DEGRADED:
+      return "DEGRADED";
+    case LinkState::DOWN:
+      return "DOWN";
+  }
+  return "UNKNOWN";
+}
+
+bool LinkMonitor::record_timeout(uint32_t now) {
+  if (this->consecutive_timeouts_ < UINT8_MAX) {
+    this->consecutive_timeouts_++;
+  }
+
+  if (this->state_ == LinkState::DOWN) {
+    this->probe_interval_ = std::min(this->probe_interval_ * 2, PROBE_INTERVAL_MAX_MS);
+    return false;
+  }
+
+  if (this->consecutive_timeouts_ >= this->down_threshold_) {
+    this->state_ = LinkState::DOWN;
+    this->probe_interval_ = PROBE_INTERVAL_MIN_MS;
+    this->last_probe_time_ = now;
+    return true;
+  }
+
+  if (this->state_ == LinkState::UP) {
+    this->state_ = LinkState::DEGRADED;
+    return true;
+  }
+  return false;
+}
+
+bool LinkMonitor::record_response() {
+  this->consecutive_timeouts_ = 0;
+  if (this->state_ == LinkState::UP) {
+    return false;
+  }
+  this->state_ = LinkState::UP;
+  this->probe_interval_ = PROBE_INTERVAL_MIN_MS;
+  return true;
+}
+
+bool LinkMonitor::probe_due(uint32_t now) const {
+  return this->state_ == LinkState::DOWN && now - this->last_probe_time_ >= this->probe_interval_;
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome::epson_projector {
+
+enum class LinkState : uint8_t {
+  UP,
+  DEGRADED,
+  DOWN,
+};
+
+const char *link_state_to_string(LinkState state);
+
+class LinkMonitor {
+ public:
+  void set_down_threshold(uint8_t threshold) { this->down_threshold_ = threshold > 0 ? threshold : 1; }
+  [[nodiscard]] uint8_t down_threshold() const { return this->down_threshold_; }
+
+  [[nodiscard]] LinkState state() const { return this->state_; }
+  [[nodiscard]] bool is_down() const { return this->state_ == LinkState::DOWN; }
+  [[nodiscard]] uint8_t consecutive_timeouts() const { return this->consecutive_timeouts_; }
+  [[nodiscard]] uint32_t probe_interval() const { return this->probe_interval_; }
+
+  bool record_timeout(uint32_t now);
+  bool record_response();
+
+  [[nodiscard]] bool probe_due(uint32_t now) const;
+  void mark_probe_sent(uint32_t now) { this->last_probe_time_ = now; }
+
+  static constexpr uint32_t PROBE_INTERVAL_MIN_MS = 5000;
+  static constexpr uint32_t PROBE_INTERVAL_MAX_MS = 60000;
+
+ private:
+  LinkState state_{LinkState::UP};
+  uint8_t down_threshold_{3};
+  uint8_t consecutive_timeouts_{0};
+  uint32_t last_probe_time_{0};
+  uint32_t probe_interval_{PROBE_INTERVAL_MIN_MS};
+};
+
+}  // namespace esphome::epson_projector
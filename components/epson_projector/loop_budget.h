@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome::epson_projector {
+
+// Limits how much received data one loop() iteration consumes. Whatever is left stays in the
+// transport buffer and is picked up by the next iteration.
+class LoopBudget {
+ public:
+  constexpr LoopBudget(uint32_t start_us, uint32_t time_us, uint16_t bytes)
+      : start_us_(start_us), time_us_(time_us), bytes_left_(bytes) {}
+
+  constexpr bool take_byte(uint32_t now_us) {
+    if (this->bytes_left_ == 0 || (this->time_us_ > 0 && now_us - this->start_us_ >= this->time_us_)) {
+      this->exhausted_ = true;
+      return false;
+    }
+    this->bytes_left_--;
+    return true;
+  }
+
+  [[nodiscard]] constexpr bool exhausted() const { return this->exhausted_; }
+
+ private:
+  uint32_t start_us_;
+  uint32_t time_us_;
+  uint16_t bytes_left_;
+  bool exhausted_{false};
+};
+
+}  // namespace esphome::epson_projector
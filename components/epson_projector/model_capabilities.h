@@ -0,0 +1,64 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#include "query_metadata.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace esphome::epson_projector {
+
+constexpr uint32_t query_bit(QueryType type) { return 1u << static_cast<uint8_t>(type); }
+
+#ifdef EPSON_PROJECTOR_MODEL_NAME
+inline constexpr const char *MODEL_NAME = EPSON_PROJECTOR_MODEL_NAME;
+#else
+inline constexpr const char *MODEL_NAME = "Generic ESC/VP21";
+#endif
+
+#ifdef EPSON_PROJECTOR_UNSUPPORTED_QUERIES
+inline constexpr uint32_t MODEL_UNSUPPORTED_QUERIES = EPSON_PROJECTOR_UNSUPPORTED_QUERIES;
+#else
+inline constexpr uint32_t MODEL_UNSUPPORTED_QUERIES = 0;
+#endif
+
+static_assert((MODEL_UNSUPPORTED_QUERIES & query_bit(QueryType::POWER)) == 0, "Every model must support power");
+
+constexpr bool model_supports(QueryType type) { return (MODEL_UNSUPPORTED_QUERIES & query_bit(type)) == 0; }
+
+// Queries some entity or scene uses. Parsers and setters of the others are left out of the build.
+#ifdef EPSON_PROJECTOR_USED_QUERIES
+inline constexpr uint32_t USED_QUERIES = EPSON_PROJECTOR_USED_QUERIES | query_bit(QueryType::POWER);
+#else
+inline constexpr uint32_t USED_QUERIES = UINT32_MAX;
+#endif
+
+inline constexpr uint32_t COMPILED_QUERIES = USED_QUERIES & ~MODEL_UNSUPPORTED_QUERIES;
+
+constexpr bool query_compiled_in(QueryType type) { return (COMPILED_QUERIES & query_bit(type)) != 0; }
+
+// Copies the entries of a constexpr table whose `type` is in the mask, so the rest are never referenced.
+template <const auto &Entries, uint32_t Mask = COMPILED_QUERIES>
+constexpr auto compiled_entries() {
+  using Entry = std::remove_cvref_t<decltype(Entries[0])>;
+  constexpr size_t COUNT = [] {
+    size_t count = 0;
+    for (const Entry &entry : Entries) {
+      count += (Mask & query_bit(entry.type)) != 0 ? 1 : 0;
+    }
+    return count;
+  }();
+  std::array<Entry, COUNT> selected{};
+  size_t index = 0;
+  for (const Entry &entry : Entries) {
+    if ((Mask & query_bit(entry.type)) != 0) {
+      selected[index++] = entry;
+    }
+  }
+  return selected;
+}
+
+}  // namespace esphome::epson_projector
@@ -475,6 +475,35 @@ def has_feature(model_id: str, feature: str) -> bool:
     return bool(model["features"].get(feature))
 
 
+OPTIONAL_FEATURES = [
+    "mute",
+    "volume",
+    "brightness",
+    "contrast",
+    "color_modes",
+    "aspect_ratios",
+    "keystone_vertical",
+    "keystone_horizontal",
+    "luminance",
+    "gamma",
+]
+
+
+def get_unsupported_features(model_id: str) -> list[str]:
+    model = get_model(model_id)
+    if model is None:
+        return []
+    return [feature for feature in OPTIONAL_FEATURES if not model["features"].get(feature)]
+
+
+def get_common_unsupported_features(model_ids: list[str]) -> list[str]:
+    if not model_ids:
+        return []
+    unsupported = [set(get_unsupported_features(model_id)) for model_id in model_ids]
+    common = set.intersection(*unsupported)
+    return [feature for feature in OPTIONAL_FEATURES if feature in common]
+
+
 def get_color_modes_for_model(model_id: str) -> dict[str, str]:
     model = get_model(model_id)
     if model is None:
@@ -42,7 +42,7 @@ from .const import (
     VOLUME_MAX,
     VOLUME_MIN,
 )
-from .platform_helpers import get_projector_parent, projector_platform_schema
+from .platform_helpers import get_projector_parent, projector_platform_schema, validate_model_features
 
 DEPENDENCIES = ["epson_projector"]
 FILTER_SOURCE_FILES = _filter_platform_sources
@@ -51,9 +51,9 @@ EpsonNumber = epson_projector_ns.class_("EpsonNumber", number.Number, cg.Compone
 NumberType = epson_projector_ns.enum("NumberType", is_class=True)
 
 
-def _number_schema_with_slider(entity_class, icon):
+def _number_schema_with_slider(key, icon):
     return number.number_schema(
-        entity_class,
+        EpsonNumber.template(NUMBER_TYPES[key]),
         icon=icon,
         entity_category=ENTITY_CATEGORY_CONFIG,
     ).extend(
@@ -89,23 +89,25 @@ NUMBER_RANGES = {
 
 CONFIG_SCHEMA = projector_platform_schema(
     {
-        cv.Optional(CONF_BRIGHTNESS): _number_schema_with_slider(EpsonNumber, ICON_BRIGHTNESS),
-        cv.Optional(CONF_CONTRAST): _number_schema_with_slider(EpsonNumber, ICON_CONTRAST),
-        cv.Optional(CONF_VOLUME): _number_schema_with_slider(EpsonNumber, ICON_VOLUME),
-        cv.Optional(CONF_SHARPNESS): _number_schema_with_slider(EpsonNumber, ICON_SHARPNESS),
-        cv.Optional(CONF_DENSITY): _number_schema_with_slider(EpsonNumber, ICON_DENSITY),
-        cv.Optional(CONF_TINT): _number_schema_with_slider(EpsonNumber, ICON_TINT),
-        cv.Optional(CONF_COLOR_TEMPERATURE): _number_schema_with_slider(EpsonNumber, ICON_COLOR_TEMPERATURE),
-        cv.Optional(CONF_V_KEYSTONE): _number_schema_with_slider(EpsonNumber, ICON_V_KEYSTONE),
-        cv.Optional(CONF_H_KEYSTONE): _number_schema_with_slider(EpsonNumber, ICON_H_KEYSTONE),
+        cv.Optional(CONF_BRIGHTNESS): _number_schema_with_slider(CONF_BRIGHTNESS, ICON_BRIGHTNESS),
+        cv.Optional(CONF_CONTRAST): _number_schema_with_slider(CONF_CONTRAST, ICON_CONTRAST),
+        cv.Optional(CONF_VOLUME): _number_schema_with_slider(CONF_VOLUME, ICON_VOLUME),
+        cv.Optional(CONF_SHARPNESS): _number_schema_with_slider(CONF_SHARPNESS, ICON_SHARPNESS),
+        cv.Optional(CONF_DENSITY): _number_schema_with_slider(CONF_DENSITY, ICON_DENSITY),
+        cv.Optional(CONF_TINT): _number_schema_with_slider(CONF_TINT, ICON_TINT),
+        cv.Optional(CONF_COLOR_TEMPERATURE): _number_schema_with_slider(CONF_COLOR_TEMPERATURE, ICON_COLOR_TEMPERATURE),
+        cv.Optional(CONF_V_KEYSTONE): _number_schema_with_slider(CONF_V_KEYSTONE, ICON_V_KEYSTONE),
+        cv.Optional(CONF_H_KEYSTONE): _number_schema_with_slider(CONF_H_KEYSTONE, ICON_H_KEYSTONE),
     }
 )
 
 
+FINAL_VALIDATE_SCHEMA = validate_model_features("number")
+
 async def to_code(config):
     parent = await get_projector_parent(config)
 
-    for key, number_type in NUMBER_TYPES.items():
+    for key in NUMBER_TYPES:
         if conf := config.get(key):
             ranges = NUMBER_RANGES[key]
             num = await number.new_number(
@@ -116,4 +118,3 @@ async def to_code(config):
             )
             await cg.register_component(num, conf)
             cg.add(num.set_parent(parent))
-            cg.add(num.set_number_type(number_type))
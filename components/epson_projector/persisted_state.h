@@ -0,0 +1,65 @@
+#pragma once
+
+#include "projector_state.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace esphome::epson_projector {
+
+static constexpr uint8_t PERSISTED_STATE_VERSION = 1;
+static constexpr size_t PERSISTED_CODE_SIZE = STATE_CODE_LENGTH + 1;
+static constexpr size_t PERSISTED_SERIAL_SIZE = STATE_SERIAL_LENGTH + 1;
+
+struct PersistedState {
+  uint8_t version;
+  uint8_t power_state;
+  uint8_t flags;  // StateFlag bits
+  uint8_t error_code;
+  uint32_t lamp_hours;
+  uint32_t received_queries;
+  uint8_t volume;
+  uint8_t brightness;
+  uint8_t contrast;
+  uint8_t sharpness;
+  uint8_t density;
+  uint8_t tint;
+  uint8_t color_temp;
+  uint8_t v_keystone;
+  uint8_t h_keystone;
+  char source[PERSISTED_CODE_SIZE];
+  char color_mode[PERSISTED_CODE_SIZE];
+  char aspect_ratio[PERSISTED_CODE_SIZE];
+  char luminance[PERSISTED_CODE_SIZE];
+  char gamma[PERSISTED_CODE_SIZE];
+  char serial_number[PERSISTED_SERIAL_SIZE];
+};
+
+static_assert(std::is_trivially_copyable_v<PersistedState>, "PersistedState is stored as raw bytes");
+static_assert(sizeof(PersistedState) <= 64, "PersistedState should stay within one preference slot budget");
+
+template <size_t N>
+void store_fixed(char (&dst)[N], std::string_view src) {
+  size_t len = src.size() < N - 1 ? src.size() : N - 1;
+  std::memcpy(dst, src.data(), len);
+  std::memset(dst + len, 0, N - len);
+}
+
+template <size_t N>
+std::string load_fixed(const char (&src)[N]) {
+  size_t len = 0;
+  while (len < N && src[len] != '\0') {
+    len++;
+  }
+  return std::string(src, len);
+}
+
+inline bool is_compatible(const PersistedState &state) {
+  return state.version == PERSISTED_STATE_VERSION;
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,40 @@
+#include "picture_scene.h"
+
+namespace esphome::epson_projector {
+
+namespace {
+
+template <typename T>
+bool needs_write(const std::optional<T> &target, const std::optional<T> &current, bool force) {
+  return target.has_value() && (force || !current.has_value() || *target != *current);
+}
+
+}  // namespace
+
+std::vector<SceneField> diff_scene(const PictureScene &target, const PictureScene &current) {
+  std::vector<SceneField> fields;
+
+  // Switching color mode recalls that mode's stored picture settings, so
+  // everything the scene specifies after it has to be written again.
+  bool mode_change = needs_write(target.color_mode, current.color_mode, false);
+  if (mode_change) {
+    fields.push_back(SceneField::COLOR_MODE);
+  }
+
+  auto add = [&fields, mode_change](SceneField field, const auto &target_value, const auto &current_value) {
+    if (needs_write(target_value, current_value, mode_change)) {
+      fields.push_back(field);
+    }
+  };
+  add(SceneField::LUMINANCE, target.luminance, current.luminance);
+  add(SceneField::GAMMA, target.gamma, current.gamma);
+  add(SceneField::BRIGHTNESS, target.brightness, current.brightness);
+  add(SceneField::CONTRAST, target.contrast, current.contrast);
+  add(SceneField::SHARPNESS, target.sharpness, current.sharpness);
+  add(SceneField::DENSITY, target.density, current.density);
+  add(SceneField::TINT, target.tint, current.tint);
+  add(SceneField::COLOR_TEMP, target.color_temp, current.color_temp);
+  return fields;
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace esphome::epson_projector {
+
+enum class SceneField : uint8_t {
+  COLOR_MODE,
+  LUMINANCE,
+  GAMMA,
+  BRIGHTNESS,
+  CONTRAST,
+  SHARPNESS,
+  DENSITY,
+  TINT,
+  COLOR_TEMP,
+};
+
+struct PictureScene {
+  std::string name;
+  std::optional<std::string> color_mode;
+  std::optional<std::string> luminance;
+  std::optional<std::string> gamma;
+  std::optional<int> brightness;
+  std::optional<int> contrast;
+  std::optional<int> sharpness;
+  std::optional<int> density;
+  std::optional<int> tint;
+  std::optional<int> color_temp;
+};
+
+std::vector<SceneField> diff_scene(const PictureScene &target, const PictureScene &current);
+
+}  // namespace esphome::epson_projector
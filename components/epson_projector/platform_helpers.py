@@ -1,8 +1,11 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
+from esphome.const import CONF_ID
+import esphome.final_validate as fv
 
-from . import EpsonProjector
-from .const import CONF_PROJECTOR_ID
+from . import ENTITY_QUERIES, FEATURE_QUERIES, EpsonProjector, _hub_configs
+from .const import CONF_MODEL, CONF_PROJECTOR_ID
+from .models import get_unsupported_features
 
 
 def projector_platform_schema(schema_dict: dict) -> cv.Schema:
@@ -16,3 +19,25 @@ def projector_platform_schema(schema_dict: dict) -> cv.Schema:
 
 async def get_projector_parent(config):
     return await cg.get_variable(config[CONF_PROJECTOR_ID])
+
+
+# The epson_projector config of the hub an entity belongs to. hub_configs defaults to the final config.
+def get_hub_config(config, hub_configs=None) -> dict:
+    projector_id = config[CONF_PROJECTOR_ID]
+    if hub_configs is None:
+        hub_configs = _hub_configs()
+    return next(hub_config for hub_config in hub_configs if hub_config[CONF_ID].id == projector_id.id)
+
+
+# Final validation for a platform: rejects entities whose query the hub's model does not support.
+def validate_model_features(platform: str):
+    def validator(config):
+        hub_config = get_hub_config(config, fv.full_config.get()["epson_projector"])
+        model_id = hub_config[CONF_MODEL]
+        unsupported = {FEATURE_QUERIES[feature] for feature in get_unsupported_features(model_id)}
+        for key, query in ENTITY_QUERIES[platform].items():
+            if key in config and query in unsupported:
+                raise cv.Invalid(f"Model {model_id} does not support {key}", path=[key])
+        return config
+
+    return validator
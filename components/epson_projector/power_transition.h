@@ -0,0 +1,56 @@
+#pragma once
+
+#include "protocol_constants.h"
+
+#include <cstdint>
+
+namespace esphome::epson_projector {
+
+enum class PowerTransition : uint8_t {
+  NONE,
+  WARMING_UP,
+  POWERED_ON,
+  COOLING_DOWN,
+  POWERED_OFF,
+};
+
+constexpr PowerTransition classify_power_transition(PowerState previous, PowerState current) {
+  if (previous == current) {
+    return PowerTransition::NONE;
+  }
+  switch (current) {
+    case PowerState::WARMUP:
+      return PowerTransition::WARMING_UP;
+    case PowerState::ON:
+      return PowerTransition::POWERED_ON;
+    case PowerState::COOLDOWN:
+      return PowerTransition::COOLING_DOWN;
+    case PowerState::STANDBY:
+      return PowerTransition::POWERED_OFF;
+    case PowerState::UNKNOWN:
+      break;
+  }
+  return PowerTransition::NONE;
+}
+
+constexpr const char *power_state_to_string(PowerState state) {
+  switch (state) {
+    case PowerState::STANDBY:
+      return "STANDBY";
+    case PowerState::ON:
+      return "ON";
+    case PowerState::WARMUP:
+      return "WARMUP";
+    case PowerState::COOLDOWN:
+      return "COOLDOWN";
+    case PowerState::UNKNOWN:
+      break;
+  }
+  return "UNKNOWN";
+}
+
+constexpr bool is_transitional(PowerState state) {
+  return state == PowerState::WARMUP || state == PowerState::COOLDOWN;
+}
+
+}  // namespace esphome::epson_projector
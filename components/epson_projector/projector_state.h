@@ -0,0 +1,78 @@
+#pragma once
+
+#include "protocol_constants.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace esphome::epson_projector {
+
+static constexpr size_t STATE_CODE_LENGTH = 4;
+static constexpr size_t STATE_SERIAL_LENGTH = 16;
+
+// NUL-terminated inline string for short protocol values. Longer values are truncated to N characters.
+template <size_t N>
+class FixedString {
+ public:
+  FixedString &operator=(std::string_view value) {
+    size_t len = value.size() < N ? value.size() : N;
+    std::memcpy(this->data_, value.data(), len);
+    std::memset(this->data_ + len, 0, sizeof(this->data_) - len);
+    return *this;
+  }
+
+  [[nodiscard]] size_t size() const { return std::strlen(this->data_); }
+  [[nodiscard]] bool empty() const { return this->data_[0] == '\0'; }
+  [[nodiscard]] const char *c_str() const { return this->data_; }
+  [[nodiscard]] std::string_view view() const { return {this->data_, this->size()}; }
+
+  bool operator==(std::string_view other) const { return this->view() == other; }
+
+ private:
+  char data_[N + 1]{};
+};
+
+enum StateFlag : uint8_t {
+  STATE_FLAG_MUTED = 1 << 0,
+  STATE_FLAG_H_REVERSE = 1 << 1,
+  STATE_FLAG_V_REVERSE = 1 << 2,
+  STATE_FLAG_FROZEN = 1 << 3,
+};
+
+// Last known projector values. Every setting the protocol reports fits in a byte, so the whole
+// state lives inline in the hub with no heap behind it.
+struct ProjectorState {
+  uint32_t lamp_hours{0};
+  PowerState power{PowerState::UNKNOWN};
+  uint8_t error_code{0};
+  uint8_t flags{0};
+  uint8_t volume{0};
+  uint8_t brightness{0};
+  uint8_t contrast{0};
+  uint8_t sharpness{0};
+  uint8_t density{0};
+  uint8_t tint{0};
+  uint8_t color_temp{0};
+  uint8_t v_keystone{0};
+  uint8_t h_keystone{0};
+  FixedString<STATE_CODE_LENGTH> source;
+  FixedString<STATE_CODE_LENGTH> color_mode;
+  FixedString<STATE_CODE_LENGTH> aspect_ratio;
+  FixedString<STATE_CODE_LENGTH> luminance;
+  FixedString<STATE_CODE_LENGTH> gamma;
+  FixedString<STATE_SERIAL_LENGTH> serial_number;
+
+  [[nodiscard]] bool has_flag(StateFlag flag) const { return (this->flags & flag) != 0; }
+  void set_flag(StateFlag flag, bool on) {
+    this->flags = on ? static_cast<uint8_t>(this->flags | flag) : static_cast<uint8_t>(this->flags & ~flag);
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<ProjectorState>, "ProjectorState must not own heap memory");
+static_assert(sizeof(ProjectorState) <= 60, "ProjectorState grew past its size budget");
+
+}  // namespace esphome::epson_projector
@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string_view>
 
 namespace esphome::epson_projector {
 
@@ -74,4 +75,13 @@ constexpr const QueryInfo *find_query_info(QueryType type) {
   return nullptr;
 }
 
+constexpr const QueryInfo *find_query_info(std::string_view cmd) {
+  for (const auto &info : QUERY_TABLE) {
+    if (cmd == info.cmd) {
+      return &info;
+    }
+  }
+  return nullptr;
+}
+
 }  // namespace esphome::epson_projector
@@ -0,0 +1,30 @@
+#include "query_support.h"
+
+namespace esphome::epson_projector {
+
+bool QuerySupport::record_error(QueryType type) {
+  if (type == QueryType::POWER || this->is_retired(type)) {
+    return false;
+  }
+  uint8_t &errors = this->errors_[index(type)];
+  if (errors < UINT8_MAX) {
+    errors++;
+  }
+  if (errors < this->error_threshold_) {
+    return false;
+  }
+  this->retired_ |= bit(type);
+  return true;
+}
+
+void QuerySupport::record_success(QueryType type) {
+  this->errors_[index(type)] = 0;
+  this->retired_ &= ~bit(type);
+}
+
+void QuerySupport::reset() {
+  this->errors_.fill(0);
+  this->retired_ = 0;
+}
+
+}  // namespace esphome::epson_projector
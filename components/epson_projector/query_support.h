@@ -0,0 +1,33 @@
+#pragma once
+
+#include "query_metadata.h"
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+namespace esphome::epson_projector {
+
+class QuerySupport {
+ public:
+  void set_error_threshold(uint8_t threshold) { this->error_threshold_ = threshold > 0 ? threshold : 1; }
+  [[nodiscard]] uint8_t error_threshold() const { return this->error_threshold_; }
+
+  bool record_error(QueryType type);
+  void record_success(QueryType type);
+  void reset();
+
+  [[nodiscard]] bool is_retired(QueryType type) const { return (this->retired_ & bit(type)) != 0; }
+  [[nodiscard]] uint32_t retired_mask() const { return this->retired_; }
+  [[nodiscard]] uint8_t consecutive_errors(QueryType type) const { return this->errors_[index(type)]; }
+
+ private:
+  static constexpr size_t index(QueryType type) { return static_cast<size_t>(type); }
+  static constexpr uint32_t bit(QueryType type) { return 1u << index(type); }
+
+  std::array<uint8_t, std::size(QUERY_TABLE)> errors_{};
+  uint32_t retired_{0};
+  uint8_t error_threshold_{3};
+};
+
+}  // namespace esphome::epson_projector
@@ -1,11 +1,15 @@
 #include "response_parser.h"
 
+#include "model_capabilities.h"
+#include "value_scale.h"
+
 #include <algorithm>
 #include <cctype>
 #include <cerrno>
 #include <climits>
 #include <cstdlib>
 #include <optional>
+#include <string_view>
 
 namespace esphome::epson_projector {
 
@@ -47,32 +51,32 @@ bool is_bool_true(const std::string &value) {
   return value == ARG_ON || value == ARG_ON_NUMERIC;
 }
 
-ParseResult make_volume(int v) {
-  return VolumeResponse{v};
+ParseResult make_volume(int v, uint8_t raw) {
+  return VolumeResponse{v, raw};
 }
-ParseResult make_brightness(int v) {
-  return BrightnessResponse{v};
+ParseResult make_brightness(int v, uint8_t raw) {
+  return BrightnessResponse{v, raw};
 }
-ParseResult make_contrast(int v) {
-  return ContrastResponse{v};
+ParseResult make_contrast(int v, uint8_t raw) {
+  return ContrastResponse{v, raw};
 }
-ParseResult make_sharpness(int v) {
-  return SharpnessResponse{v};
+ParseResult make_sharpness(int v, uint8_t raw) {
+  return SharpnessResponse{v, raw};
 }
-ParseResult make_density(int v) {
-  return DensityResponse{v};
+ParseResult make_density(int v, uint8_t raw) {
+  return DensityResponse{v, raw};
 }
-ParseResult make_tint(int v) {
-  return TintResponse{v};
+ParseResult make_tint(int v, uint8_t raw) {
+  return TintResponse{v, raw};
 }
-ParseResult make_color_temp(int v) {
-  return ColorTempResponse{v};
+ParseResult make_color_temp(int v, uint8_t raw) {
+  return ColorTempResponse{v, raw};
 }
-ParseResult make_v_keystone(int v) {
-  return VKeystoneResponse{v};
+ParseResult make_v_keystone(int v, uint8_t raw) {
+  return VKeystoneResponse{v, raw};
 }
-ParseResult make_h_keystone(int v) {
-  return HKeystoneResponse{v};
+ParseResult make_h_keystone(int v, uint8_t raw) {
+  return HKeystoneResponse{v, raw};
 }
 
 ParseResult make_mute(bool v) {
@@ -108,47 +112,71 @@ ParseResult make_serial(const std::string &v) {
 }
 
 struct ScaledIntEntry {
+  QueryType type;
   const char *cmd;
-  int ui_max;
-  ParseResult (*make)(int);
+  int (*from_raw)(int);
+  ParseResult (*make)(int, uint8_t);
 };
 
 struct BoolEntry {
+  QueryType type;
   const char *cmd;
   ParseResult (*make)(bool);
 };
 
 struct StringEntry {
+  QueryType type;
   const char *cmd;
   ParseResult (*make)(const std::string &);
 };
 
-constexpr ScaledIntEntry SCALED_INT_PARSERS[] = {
-    {CMD_VOLUME, VOLUME_MAX, make_volume},
-    {CMD_BRIGHTNESS, BRIGHTNESS_MAX, make_brightness},
-    {CMD_CONTRAST, CONTRAST_MAX, make_contrast},
-    {CMD_SHARPNESS, SHARPNESS_MAX, make_sharpness},
-    {CMD_DENSITY, DENSITY_MAX, make_density},
-    {CMD_TINT, TINT_MAX, make_tint},
-    {CMD_COLOR_TEMP, COLOR_TEMP_MAX, make_color_temp},
-    {CMD_VKEYSTONE, KEYSTONE_MAX, make_v_keystone},
-    {CMD_HKEYSTONE, KEYSTONE_MAX, make_h_keystone},
+constexpr ScaledIntEntry ALL_SCALED_INT_PARSERS[] = {
+    {QueryType::VOLUME, CMD_VOLUME, ValueScale<VOLUME_MAX>::from_raw, make_volume},
+    {QueryType::BRIGHTNESS, CMD_BRIGHTNESS, ValueScale<BRIGHTNESS_MAX>::from_raw, make_brightness},
+    {QueryType::CONTRAST, CMD_CONTRAST, ValueScale<CONTRAST_MAX>::from_raw, make_contrast},
+    {QueryType::SHARPNESS, CMD_SHARPNESS, ValueScale<SHARPNESS_MAX>::from_raw, make_sharpness},
+    {QueryType::DENSITY, CMD_DENSITY, ValueScale<DENSITY_MAX>::from_raw, make_density},
+    {QueryType::TINT, CMD_TINT, ValueScale<TINT_MAX>::from_raw, make_tint},
+    {QueryType::COLOR_TEMP, CMD_COLOR_TEMP, ValueScale<COLOR_TEMP_MAX>::from_raw, make_color_temp},
+    {QueryType::V_KEYSTONE, CMD_VKEYSTONE, ValueScale<KEYSTONE_MAX>::from_raw, make_v_keystone},
+    {QueryType::H_KEYSTONE, CMD_HKEYSTONE, ValueScale<KEYSTONE_MAX>::from_raw, make_h_keystone},
 };
 
-constexpr BoolEntry BOOL_PARSERS[] = {
-    {CMD_MUTE, make_mute},
-    {CMD_HREVERSE, make_h_reverse},
-    {CMD_VREVERSE, make_v_reverse},
-    {CMD_FREEZE, make_freeze},
+constexpr BoolEntry ALL_BOOL_PARSERS[] = {
+    {QueryType::MUTE, CMD_MUTE, make_mute},
+    {QueryType::H_REVERSE, CMD_HREVERSE, make_h_reverse},
+    {QueryType::V_REVERSE, CMD_VREVERSE, make_v_reverse},
+    {QueryType::FREEZE, CMD_FREEZE, make_freeze},
 };
 
-constexpr StringEntry STRING_PARSERS[] = {
-    {CMD_SOURCE, make_source},       {CMD_COLOR_MODE, make_color_mode}, {CMD_ASPECT, make_aspect_ratio},
-    {CMD_LUMINANCE, make_luminance}, {CMD_GAMMA, make_gamma},           {CMD_SERIAL, make_serial},
+constexpr StringEntry ALL_STRING_PARSERS[] = {
+    {QueryType::SOURCE, CMD_SOURCE, make_source},
+    {QueryType::COLOR_MODE, CMD_COLOR_MODE, make_color_mode},
+    {QueryType::ASPECT_RATIO, CMD_ASPECT, make_aspect_ratio},
+    {QueryType::LUMINANCE, CMD_LUMINANCE, make_luminance},
+    {QueryType::GAMMA, CMD_GAMMA, make_gamma},
+    {QueryType::SERIAL_NUMBER, CMD_SERIAL, make_serial},
 };
 
+// Only parsers for compiled-in queries are kept; replies to the others fall through to StringResponse.
+constexpr auto SCALED_INT_PARSERS = compiled_entries<ALL_SCALED_INT_PARSERS>();
+constexpr auto BOOL_PARSERS = compiled_entries<ALL_BOOL_PARSERS>();
+constexpr auto STRING_PARSERS = compiled_entries<ALL_STRING_PARSERS>();
+
+std::string_view trim_response(std::string_view response) {
+  while (!response.empty() && (response.back() == RESPONSE_PROMPT || response.back() == CMD_TERMINATOR ||
+                               std::isspace(static_cast<unsigned char>(response.back())))) {
+    response.remove_suffix(1);
+  }
+  return response;
+}
+
 }  // namespace
 
+bool ResponseParser::is_error_response(const std::string &response) const {
+  return trim_response(response) == RESPONSE_ERR;
+}
+
 bool ResponseParser::is_complete_response(const std::string &buffer) const {
   return !buffer.empty() && buffer.back() == RESPONSE_PROMPT;
 }
@@ -158,11 +186,7 @@ compat::expected<ParseResult, std::string> ResponseParser::parse(const std::stri
     return compat::unexpected("Empty response");
   }
 
-  std::string trimmed = response;
-  while (!trimmed.empty() && (trimmed.back() == RESPONSE_PROMPT || trimmed.back() == CMD_TERMINATOR ||
-                              std::isspace(static_cast<unsigned char>(trimmed.back())))) {
-    trimmed.pop_back();
-  }
+  std::string trimmed(trim_response(response));
 
   if (trimmed.empty()) {
     return AckResponse{};
@@ -211,7 +235,7 @@ compat::expected<ParseResult, std::string> ResponseParser::parse_key_value(const
     return PowerResponse{state};
   }
 
-  if (key == CMD_LAMP) {
+  if (query_compiled_in(QueryType::LAMP_HOURS) && key == CMD_LAMP) {
     auto hours = safe_stoul(value);
     if (!hours) {
       return compat::unexpected("Invalid lamp hours value: " + value);
@@ -219,7 +243,7 @@ compat::expected<ParseResult, std::string> ResponseParser::parse_key_value(const
     return LampResponse{*hours};
   }
 
-  if (key == CMD_ERROR) {
+  if (query_compiled_in(QueryType::ERROR_CODE) && key == CMD_ERROR) {
     auto code = safe_stoi(value);
     if (!code) {
       return compat::unexpected("Invalid error code value: " + value);
@@ -233,8 +257,8 @@ compat::expected<ParseResult, std::string> ResponseParser::parse_key_value(const
       if (!raw_value) {
         return compat::unexpected("Invalid " + std::string(entry.cmd) + " value: " + value);
       }
-      int scaled = (*raw_value * entry.ui_max) / PROJECTOR_RAW_MAX;
-      return entry.make(scaled);
+      int raw = std::clamp(*raw_value, 0, PROJECTOR_RAW_MAX);
+      return entry.make(entry.from_raw(raw), static_cast<uint8_t>(raw));
     }
   }
 
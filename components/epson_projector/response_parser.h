@@ -29,16 +29,20 @@ struct MuteResponse {
   bool muted;
 };
 
+// Scaled responses keep the raw 0..255 value as well, so it can be replayed exactly.
 struct VolumeResponse {
   int value;
+  uint8_t raw;
 };
 
 struct BrightnessResponse {
   int value;
+  uint8_t raw;
 };
 
 struct ContrastResponse {
   int value;
+  uint8_t raw;
 };
 
 struct ColorModeResponse {
@@ -51,26 +55,32 @@ struct AspectRatioResponse {
 
 struct SharpnessResponse {
   int value;
+  uint8_t raw;
 };
 
 struct DensityResponse {
   int value;
+  uint8_t raw;
 };
 
 struct TintResponse {
   int value;
+  uint8_t raw;
 };
 
 struct ColorTempResponse {
   int value;
+  uint8_t raw;
 };
 
 struct VKeystoneResponse {
   int value;
+  uint8_t raw;
 };
 
 struct HKeystoneResponse {
   int value;
+  uint8_t raw;
 };
 
 struct HReverseResponse {
@@ -118,6 +128,7 @@ class ResponseParser {
  public:
   [[nodiscard]] compat::expected<ParseResult, std::string> parse(const std::string &response);
   [[nodiscard]] bool is_complete_response(const std::string &buffer) const;
+  [[nodiscard]] bool is_error_response(const std::string &response) const;
 
  private:
   compat::expected<ParseResult, std::string> parse_key_value(const std::string &key, const std::string &value);
@@ -0,0 +1,60 @@
+#include "rx_framer.h"
+
+#include "protocol_constants.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace esphome::epson_projector {
+
+FrameStatus RxFramer::push(uint8_t byte) {
+  if (this->complete_) {
+    this->buffer_.clear();
+    this->complete_ = false;
+  }
+
+  if (byte == 0 || byte > 0x7F) {
+    this->dropped_bytes_++;
+    return FrameStatus::NONE;
+  }
+  char c = static_cast<char>(byte);
+
+  if (this->discarding_) {
+    if (c != CMD_TERMINATOR) {
+      this->dropped_bytes_++;
+      return FrameStatus::NONE;
+    }
+    this->discarding_ = false;
+    this->resyncs_++;
+    return FrameStatus::RESYNC;
+  }
+
+  if (this->buffer_.size() >= CAPACITY - 1 && c != RESPONSE_PROMPT) {
+    this->overflows_++;
+    this->dropped_bytes_ += this->buffer_.size() + 1;
+    this->buffer_.clear();
+    if (c == CMD_TERMINATOR) {
+      this->resyncs_++;
+      return FrameStatus::RESYNC;
+    }
+    this->discarding_ = true;
+    return FrameStatus::NONE;
+  }
+
+  this->buffer_ += c;
+  if (c != RESPONSE_PROMPT) {
+    return FrameStatus::NONE;
+  }
+  this->complete_ = true;
+  bool bare = std::all_of(this->buffer_.begin(), this->buffer_.end() - 1,
+                          [](char ch) { return std::isspace(static_cast<unsigned char>(ch)) != 0; });
+  return bare ? FrameStatus::PROMPT : FrameStatus::FRAME;
+}
+
+void RxFramer::clear() {
+  this->buffer_.clear();
+  this->complete_ = false;
+  this->discarding_ = false;
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace esphome::epson_projector {
+
+enum class FrameStatus : uint8_t {
+  NONE,
+  FRAME,
+  PROMPT,
+  RESYNC,
+};
+
+// Splits the receive stream into ':'-terminated frames in a buffer that never grows past CAPACITY.
+// NUL and non-ASCII bytes are dropped. When a frame overflows, bytes are discarded up to the next '\r'.
+class RxFramer {
+ public:
+  static constexpr size_t CAPACITY = 128;
+
+  RxFramer() { this->buffer_.reserve(CAPACITY); }
+
+  FrameStatus push(uint8_t byte);
+  void clear();
+
+  // Valid after push() returned FRAME or PROMPT, until the next push().
+  [[nodiscard]] const std::string &frame() const { return this->buffer_; }
+  [[nodiscard]] bool is_discarding() const { return this->discarding_; }
+
+  [[nodiscard]] uint32_t overflows() const { return this->overflows_; }
+  [[nodiscard]] uint32_t resyncs() const { return this->resyncs_; }
+  [[nodiscard]] uint32_t dropped_bytes() const { return this->dropped_bytes_; }
+
+ private:
+  std::string buffer_;
+  bool complete_{false};
+  bool discarding_{false};
+  uint32_t overflows_{0};
+  uint32_t resyncs_{0};
+  uint32_t dropped_bytes_{0};
+};
+
+}  // namespace esphome::epson_projector
@@ -1,8 +1,8 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import select
-from esphome.const import ENTITY_CATEGORY_CONFIG
-from esphome.core import CORE
+from esphome.const import CONF_ID, ENTITY_CATEGORY_CONFIG
+from esphome.core import ID
 
 from . import _filter_platform_sources, epson_projector_ns
 from .const import (
@@ -25,13 +25,14 @@ from .models import (
     get_luminance_options_for_model,
     get_sources_for_model,
 )
-from .platform_helpers import get_projector_parent, projector_platform_schema
+from .platform_helpers import get_hub_config, get_projector_parent, projector_platform_schema, validate_model_features
 
 DEPENDENCIES = ["epson_projector"]
 FILTER_SOURCE_FILES = _filter_platform_sources
 
 EpsonSelect = epson_projector_ns.class_("EpsonSelect", select.Select, cg.Component)
 SelectType = epson_projector_ns.enum("SelectType", is_class=True)
+SelectOption = epson_projector_ns.struct("SelectOption")
 
 SELECT_TYPES = {
     CONF_SOURCE: SelectType.SOURCE,
@@ -44,27 +45,27 @@ SELECT_TYPES = {
 CONFIG_SCHEMA = projector_platform_schema(
     {
         cv.Optional(CONF_SOURCE): select.select_schema(
-            EpsonSelect,
+            EpsonSelect.template(SELECT_TYPES[CONF_SOURCE]),
             icon=ICON_SOURCE,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
         cv.Optional(CONF_COLOR_MODE): select.select_schema(
-            EpsonSelect,
+            EpsonSelect.template(SELECT_TYPES[CONF_COLOR_MODE]),
             icon=ICON_COLOR_MODE,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
         cv.Optional(CONF_ASPECT_RATIO): select.select_schema(
-            EpsonSelect,
+            EpsonSelect.template(SELECT_TYPES[CONF_ASPECT_RATIO]),
             icon=ICON_ASPECT,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
         cv.Optional(CONF_LUMINANCE): select.select_schema(
-            EpsonSelect,
+            EpsonSelect.template(SELECT_TYPES[CONF_LUMINANCE]),
             icon=ICON_LUMINANCE,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
         cv.Optional(CONF_GAMMA): select.select_schema(
-            EpsonSelect,
+            EpsonSelect.template(SELECT_TYPES[CONF_GAMMA]),
             icon=ICON_GAMMA,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
@@ -72,10 +73,11 @@ CONFIG_SCHEMA = projector_platform_schema(
 )
 
 
+FINAL_VALIDATE_SCHEMA = validate_model_features("select")
+
 async def to_code(config):
     parent = await get_projector_parent(config)
-    parent_config = CORE.config.get("epson_projector", {})
-    model_id = parent_config.get(CONF_MODEL, "generic")
+    model_id = get_hub_config(config)[CONF_MODEL]
 
     options_map = {
         CONF_SOURCE: get_sources_for_model(model_id),
@@ -85,13 +87,26 @@ async def to_code(config):
         CONF_GAMMA: get_gamma_options_for_model(model_id),
     }
 
-    for key, select_type in SELECT_TYPES.items():
+    for key in SELECT_TYPES:
         if conf := config.get(key):
             sel = await select.new_select(conf, options=[])
             await cg.register_component(sel, conf)
             cg.add(sel.set_parent(parent))
-            cg.add(sel.set_select_type(select_type))
 
             options = options_map.get(key, {})
-            for name, code in options.items():
-                cg.add(sel.add_option(name, code))
+            if options:
+                _add_option_table(sel, conf[CONF_ID], options)
+
+
+def _add_option_table(sel, select_id, options):
+    names = list(options)
+    by_code = sorted(range(len(names)), key=lambda index: options[names[index]])
+    table = cg.progmem_array(
+        ID(f"{select_id.id}_options", is_declaration=True, type=SelectOption),
+        cg.ArrayInitializer(*[cg.ArrayInitializer(name, options[name]) for name in names]),
+    )
+    index = cg.progmem_array(
+        ID(f"{select_id.id}_options_by_code", is_declaration=True, type=cg.uint8),
+        cg.ArrayInitializer(*by_code),
+    )
+    cg.add(sel.set_options(table, index, len(names)))
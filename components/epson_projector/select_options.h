@@ -0,0 +1,88 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_ESP8266
+#include "esphome/core/hal.h"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+namespace esphome::epson_projector {
+
+// Codegen places both tables in flash (PROGMEM) on ESP8266, so they are read through name(), code() and
+// load_index() there. The option strings themselves stay in RAM for the select traits.
+struct SelectOption {
+  const char *name;
+  const char *code;
+};
+
+class SelectOptionTable {
+ public:
+  constexpr SelectOptionTable() = default;
+  constexpr SelectOptionTable(const SelectOption *options, const uint8_t *by_code, size_t size)
+      : options_(options), by_code_(by_code), size_(size) {}
+
+  [[nodiscard]] constexpr size_t size() const { return this->size_; }
+  [[nodiscard]] constexpr bool empty() const { return this->size_ == 0; }
+  [[nodiscard]] constexpr const SelectOption &operator[](size_t index) const { return this->options_[index]; }
+
+  [[nodiscard]] constexpr const char *name(size_t index) const {
+#ifdef USE_ESP8266
+    if (!std::is_constant_evaluated()) {
+      return progmem_read_ptr(&this->options_[index].name);
+    }
+#endif
+    return this->options_[index].name;
+  }
+
+  [[nodiscard]] constexpr const char *code(size_t index) const {
+#ifdef USE_ESP8266
+    if (!std::is_constant_evaluated()) {
+      return progmem_read_ptr(&this->options_[index].code);
+    }
+#endif
+    return this->options_[index].code;
+  }
+
+  [[nodiscard]] constexpr std::optional<size_t> index_of_name(std::string_view name) const {
+    for (size_t i = 0; i < this->size_; i++) {
+      if (name == this->name(i)) {
+        return i;
+      }
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] constexpr std::optional<size_t> index_of_code(std::string_view code) const {
+    auto positions = std::views::iota(size_t{0}, this->size_);
+    auto it = std::ranges::lower_bound(positions, code, {}, [this](size_t position) {
+      return std::string_view(this->code(this->load_index(position)));
+    });
+    if (it == positions.end() || code != this->code(this->load_index(*it))) {
+      return std::nullopt;
+    }
+    return this->load_index(*it);
+  }
+
+ private:
+  [[nodiscard]] constexpr uint8_t load_index(size_t position) const {
+#ifdef USE_ESP8266
+    if (!std::is_constant_evaluated()) {
+      return progmem_read_byte(&this->by_code_[position]);
+    }
+#endif
+    return this->by_code_[position];
+  }
+
+  const SelectOption *options_{nullptr};
+  const uint8_t *by_code_{nullptr};
+  size_t size_{0};
+};
+
+}  // namespace esphome::epson_projector
@@ -26,7 +26,7 @@ SENSOR_TYPES = {
 CONFIG_SCHEMA = projector_platform_schema(
     {
         cv.Optional(CONF_LAMP_HOURS): sensor.sensor_schema(
-            EpsonSensor,
+            EpsonSensor.template(SENSOR_TYPES[CONF_LAMP_HOURS]),
             unit_of_measurement=UNIT_HOUR,
             icon=ICON_LAMP,
             accuracy_decimals=0,
@@ -35,7 +35,7 @@ CONFIG_SCHEMA = projector_platform_schema(
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
         cv.Optional(CONF_ERROR_CODE): sensor.sensor_schema(
-            EpsonSensor,
+            EpsonSensor.template(SENSOR_TYPES[CONF_ERROR_CODE]),
             icon=ICON_ERROR,
             accuracy_decimals=0,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
@@ -47,9 +47,8 @@ CONFIG_SCHEMA = projector_platform_schema(
 async def to_code(config):
     parent = await get_projector_parent(config)
 
-    for key, sensor_type in SENSOR_TYPES.items():
+    for key in SENSOR_TYPES:
         if conf := config.get(key):
             sens = await sensor.new_sensor(conf)
             await cg.register_component(sens, conf)
             cg.add(sens.set_parent(parent))
-            cg.add(sens.set_sensor_type(sensor_type))
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "protocol_constants.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+namespace esphome::epson_projector {
+
+static constexpr size_t SEQUENCE_POOL_SIZE = 4;
+static constexpr size_t SEQUENCE_FRAME_SIZE = 512;
+
+// Fixed storage for sequence coroutine frames, shared by all projectors. It only takes RAM in firmware
+// that defines a sequence.
+class SequenceFramePool {
+  static_assert(SEQUENCE_POOL_SIZE <= 8, "Frame use is tracked in one byte");
+
+ public:
+  static void *allocate(size_t size) {
+    if (size > SEQUENCE_FRAME_SIZE) {
+      return nullptr;
+    }
+    for (size_t i = 0; i < SEQUENCE_POOL_SIZE; i++) {
+      if ((used_ & (1u << i)) == 0) {
+        used_ |= 1u << i;
+        return frames_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  static void release(void *frame) {
+    for (size_t i = 0; i < SEQUENCE_POOL_SIZE; i++) {
+      if (frame == frames_[i]) {
+        used_ &= ~(1u << i);
+        return;
+      }
+    }
+  }
+
+  [[nodiscard]] static size_t in_use() {
+    size_t count = 0;
+    for (size_t i = 0; i < SEQUENCE_POOL_SIZE; i++) {
+      count += (used_ >> i) & 1u;
+    }
+    return count;
+  }
+
+ private:
+  alignas(std::max_align_t) static inline std::byte frames_[SEQUENCE_POOL_SIZE][SEQUENCE_FRAME_SIZE];
+  static inline uint8_t used_{0};
+};
+
+// Coroutine type for multi-step projector sequences. Hand one to EpsonProjector::run(); it starts on the
+// next loop() pass and is resumed from loop() whenever the step it awaits has finished. When the pool
+// is exhausted, or the frame does not fit, the sequence is empty and run() refuses it.
+class Sequence {
+ public:
+  struct promise_type {
+    static void *operator new(size_t size) noexcept { return SequenceFramePool::allocate(size); }
+    static void operator delete(void *frame) noexcept { SequenceFramePool::release(frame); }
+    static Sequence get_return_object_on_allocation_failure() { return Sequence(nullptr); }
+
+    Sequence get_return_object() { return Sequence(std::coroutine_handle<promise_type>::from_promise(*this)); }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+
+  Sequence(Sequence &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+  Sequence &operator=(Sequence &&other) noexcept {
+    if (this != &other) {
+      this->reset();
+      this->handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  Sequence(const Sequence &) = delete;
+  Sequence &operator=(const Sequence &) = delete;
+  ~Sequence() { this->reset(); }
+
+  [[nodiscard]] bool valid() const { return static_cast<bool>(this->handle_); }
+  std::coroutine_handle<> release() { return std::exchange(this->handle_, nullptr); }
+
+ private:
+  explicit Sequence(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  void reset() {
+    if (this->handle_) {
+      this->handle_.destroy();
+      this->handle_ = nullptr;
+    }
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+// A running sequence and what it is waiting for. Commands sent while it runs are counted in `pending`.
+struct SequenceSlot {
+  std::coroutine_handle<> handle;
+  uint32_t deadline{0};
+  uint8_t pending{0};
+  bool failed{false};
+  bool awaiting_power{false};
+  PowerState awaited_power{PowerState::UNKNOWN};
+
+  [[nodiscard]] bool idle() const { return !this->handle && this->pending == 0; }
+};
+
+// Returned by the hub's setters and query(). Awaiting it waits for every command sent since the last
+// step to be answered and yields true if all of them succeeded. Outside a sequence it can be ignored.
+class SequenceStep {
+ public:
+  explicit SequenceStep(SequenceSlot *slot) : slot_(slot) {}
+
+  [[nodiscard]] bool await_ready() const { return this->slot_ == nullptr || this->slot_->pending == 0; }
+  void await_suspend(std::coroutine_handle<>) const {}
+  bool await_resume() const {
+    if (this->slot_ == nullptr) {
+      return true;
+    }
+    return !std::exchange(this->slot_->failed, false);
+  }
+
+ private:
+  SequenceSlot *slot_;
+};
+
+// Returned by EpsonProjector::until(). Yields true once the projector reports the state, false if the
+// timeout passes first.
+class PowerWait {
+ public:
+  PowerWait(SequenceSlot *slot, const PowerState *power, PowerState target, uint32_t deadline)
+      : slot_(slot), power_(power), target_(target), deadline_(deadline) {}
+
+  [[nodiscard]] bool await_ready() const { return this->slot_ == nullptr || *this->power_ == this->target_; }
+  void await_suspend(std::coroutine_handle<>) const {
+    this->slot_->awaiting_power = true;
+    this->slot_->awaited_power = this->target_;
+    this->slot_->deadline = this->deadline_;
+  }
+  bool await_resume() const {
+    if (this->slot_ != nullptr) {
+      this->slot_->awaiting_power = false;
+    }
+    return *this->power_ == this->target_;
+  }
+
+ private:
+  SequenceSlot *slot_;
+  const PowerState *power_;
+  PowerState target_;
+  uint32_t deadline_;
+};
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,30 @@
+#include "snapshot_handler.h"
+
+#include "esphome/core/log.h"
+
+namespace esphome::epson_projector {
+
+static const char *const TAG = "epson_projector.snapshot";
+
+void SnapshotHandler::setup() {
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+
+void SnapshotHandler::dump_config() {
+  ESP_LOGCONFIG(TAG, "Epson Projector Snapshot:");
+  ESP_LOGCONFIG(TAG, "  Path: %s", this->path_);
+}
+
+bool SnapshotHandler::canHandle(AsyncWebServerRequest *request) const {
+  return request->method() == HTTP_GET && request->url() == this->path_;
+}
+
+void SnapshotHandler::handleRequest(AsyncWebServerRequest *request) {
+  // The buffer is kept between requests, so it only allocates until it has reached the snapshot size.
+  this->buffer_.clear();
+  this->parent_->write_snapshot(this->buffer_);
+  request->send(200, "application/json", this->buffer_.c_str());
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "esphome/components/web_server_base/web_server_base.h"
+#include "esphome/core/component.h"
+
+#include "epson_projector.h"
+
+#include <string>
+
+namespace esphome::epson_projector {
+
+// Serves EpsonProjector::write_snapshot() as JSON on one path of the web server.
+class SnapshotHandler : public AsyncWebHandler, public Component {
+ public:
+  SnapshotHandler(web_server_base::WebServerBase *base, EpsonProjector *parent, const char *path)
+      : base_(base), parent_(parent), path_(path) {}
+
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::WIFI - 1.0f; }
+
+  bool canHandle(AsyncWebServerRequest *request) const override;
+  void handleRequest(AsyncWebServerRequest *request) override;
+  bool isRequestHandlerTrivial() const override { return false; }
+
+ protected:
+  web_server_base::WebServerBase *base_;
+  EpsonProjector *parent_;
+  const char *path_;
+  std::string buffer_;
+};
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,20 @@
+#pragma once
+
+namespace esphome::epson_projector {
+
+class EpsonProjector;
+
+// Entities are chained into their projector's listener list, so notifying them needs no
+// allocation and each entity costs one pointer.
+class StateListener {
+ public:
+  virtual void on_state_change() = 0;
+
+ protected:
+  friend class EpsonProjector;
+  ~StateListener() = default;
+
+  StateListener *next_listener_{nullptr};
+};
+
+}  // namespace esphome::epson_projector
@@ -16,7 +16,7 @@ from .const import (
     ICON_PROJECTOR,
     ICON_V_REVERSE,
 )
-from .platform_helpers import get_projector_parent, projector_platform_schema
+from .platform_helpers import get_projector_parent, projector_platform_schema, validate_model_features
 
 DEPENDENCIES = ["epson_projector"]
 FILTER_SOURCE_FILES = _filter_platform_sources
@@ -35,27 +35,27 @@ SWITCH_TYPES = {
 CONFIG_SCHEMA = projector_platform_schema(
     {
         cv.Optional(CONF_POWER): switch.switch_schema(
-            EpsonSwitch,
+            EpsonSwitch.template(SWITCH_TYPES[CONF_POWER]),
             device_class=DEVICE_CLASS_SWITCH,
             icon=ICON_PROJECTOR,
         ),
         cv.Optional(CONF_MUTE): switch.switch_schema(
-            EpsonSwitch,
+            EpsonSwitch.template(SWITCH_TYPES[CONF_MUTE]),
             icon=ICON_MUTE,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
         cv.Optional(CONF_H_REVERSE): switch.switch_schema(
-            EpsonSwitch,
+            EpsonSwitch.template(SWITCH_TYPES[CONF_H_REVERSE]),
             icon=ICON_H_REVERSE,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
         cv.Optional(CONF_V_REVERSE): switch.switch_schema(
-            EpsonSwitch,
+            EpsonSwitch.template(SWITCH_TYPES[CONF_V_REVERSE]),
             icon=ICON_V_REVERSE,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
         cv.Optional(CONF_FREEZE): switch.switch_schema(
-            EpsonSwitch,
+            EpsonSwitch.template(SWITCH_TYPES[CONF_FREEZE]),
             icon=ICON_FREEZE,
             entity_category=ENTITY_CATEGORY_CONFIG,
         ),
@@ -63,12 +63,13 @@ CONFIG_SCHEMA = projector_platform_schema(
 )
 
 
+FINAL_VALIDATE_SCHEMA = validate_model_features("switch")
+
 async def to_code(config):
     parent = await get_projector_parent(config)
 
-    for key, switch_type in SWITCH_TYPES.items():
+    for key in SWITCH_TYPES:
         if conf := config.get(key):
             sw = await switch.new_switch(conf)
             await cg.register_component(sw, conf)
             cg.add(sw.set_parent(parent))
-            cg.add(sw.set_switch_type(switch_type))
@@ -0,0 +1,237 @@
+#include "tcp_transport.h"
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <netdb.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace esphome::epson_projector {
+
+static const char *const TAG = "epson_projector.tcp";
+
+namespace {
+
+bool is_would_block(int err) {
+  return err == EAGAIN || err == EWOULDBLOCK || err == EINPROGRESS || err == EALREADY || err == ENOTCONN;
+}
+
+// Accepts an IPv4 literal or a host name; names are looked up on every connect, so a new DHCP lease is picked up.
+socklen_t resolve_host(struct sockaddr_storage &addr, const std::string &host, uint16_t port) {
+  auto *sa = reinterpret_cast<struct sockaddr *>(&addr);
+  socklen_t addr_len = socket::set_sockaddr(sa, sizeof(addr), host, port);
+  if (addr_len != 0) {
+    return addr_len;
+  }
+  struct addrinfo hints {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *result = nullptr;
+  if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || result == nullptr) {
+    return 0;
+  }
+  char ip[INET_ADDRSTRLEN];
+  auto *resolved = reinterpret_cast<struct sockaddr_in *>(result->ai_addr);
+  bool converted = inet_ntop(AF_INET, &resolved->sin_addr, ip, sizeof(ip)) != nullptr;
+  freeaddrinfo(result);
+  return converted ? socket::set_sockaddr(sa, sizeof(addr), ip, port) : 0;
+}
+
+}  // namespace
+
+void TcpTransport::loop() {
+  uint32_t now = millis();
+  switch (this->state_) {
+    case State::DISCONNECTED:
+      if (now - this->state_time_ >= this->reconnect_delay_) {
+        this->start_connect(now);
+      }
+      break;
+    case State::CONNECTING:
+      this->poll_connecting(now);
+      break;
+    case State::HANDSHAKE:
+      this->poll_handshake(now);
+      break;
+    case State::CONNECTED:
+      this->flush_tx(now);
+      break;
+  }
+}
+
+void TcpTransport::dump_config() {
+  ESP_LOGCONFIG(TAG, "  Transport: ESC/VP.net TCP");
+  ESP_LOGCONFIG(TAG, "  Host: %s:%u", this->host_.c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Connected: %s", this->is_connected() ? "YES" : "NO");
+}
+
+void TcpTransport::start_connect(uint32_t now) {
+  this->state_time_ = now;
+  this->socket_ = socket::socket_ip(SOCK_STREAM, 0);
+  if (this->socket_ == nullptr) {
+    this->disconnect(now, "socket creation failed");
+    return;
+  }
+  this->socket_->setblocking(false);
+  int enable = 1;
+  this->socket_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+  struct sockaddr_storage addr {};
+  socklen_t addr_len = resolve_host(addr, this->host_, this->port_);
+  if (addr_len == 0) {
+    this->disconnect(now, "could not resolve host");
+    return;
+  }
+
+  ESP_LOGD(TAG, "Connecting to %s:%u", this->host_.c_str(), this->port_);
+  if (this->socket_->connect(reinterpret_cast<struct sockaddr *>(&addr), addr_len) != 0 && !is_would_block(errno)) {
+    this->disconnect(now, strerror(errno));
+    return;
+  }
+  this->handshake_len_ = 0;
+  this->handshake_skip_ = 0;
+  this->state_ = State::CONNECTING;
+}
+
+void TcpTransport::poll_connecting(uint32_t now) {
+  auto request = build_escvp_net_connect();
+  ssize_t written = this->socket_->write(request.data(), request.size());
+  if (written == static_cast<ssize_t>(request.size())) {
+    this->state_ = State::HANDSHAKE;
+    this->state_time_ = now;
+    return;
+  }
+  if (written >= 0 || !is_would_block(errno)) {
+    this->disconnect(now, written >= 0 ? "short handshake write" : strerror(errno));
+    return;
+  }
+  if (now - this->state_time_ > CONNECT_TIMEOUT_MS) {
+    this->disconnect(now, "connect timeout");
+  }
+}
+
+void TcpTransport::poll_handshake(uint32_t now) {
+  while (this->handshake_len_ < ESCVP_NET_HEADER_SIZE) {
+    ssize_t n = this->socket_->read(this->handshake_buf_ + this->handshake_len_,
+                                    ESCVP_NET_HEADER_SIZE - this->handshake_len_);
+    if (n <= 0) {
+      if (n == 0 || !is_would_block(errno)) {
+        this->disconnect(now, n == 0 ? "closed during handshake" : strerror(errno));
+      } else if (now - this->state_time_ > CONNECT_TIMEOUT_MS) {
+        this->disconnect(now, "handshake timeout");
+      }
+      return;
+    }
+    this->handshake_len_ += n;
+    if (this->handshake_len_ == ESCVP_NET_HEADER_SIZE) {
+      auto reply = parse_escvp_net_reply(this->handshake_buf_, this->handshake_len_);
+      if (reply.result == HandshakeResult::REJECTED) {
+        ESP_LOGW(TAG, "Projector refused connection: %s", escvp_net_status_to_string(reply.status));
+        this->disconnect(now, "handshake rejected");
+        return;
+      }
+      if (reply.result != HandshakeResult::ACCEPTED) {
+        this->disconnect(now, "invalid handshake reply");
+        return;
+      }
+      this->handshake_skip_ = static_cast<size_t>(reply.field_count) * ESCVP_NET_FIELD_SIZE;
+    }
+  }
+
+  while (this->handshake_skip_ > 0) {
+    uint8_t discard[ESCVP_NET_FIELD_SIZE];
+    ssize_t n = this->socket_->read(discard, std::min(this->handshake_skip_, sizeof(discard)));
+    if (n <= 0) {
+      if (n == 0 || !is_would_block(errno)) {
+        this->disconnect(now, n == 0 ? "closed during handshake" : strerror(errno));
+      }
+      return;
+    }
+    this->handshake_skip_ -= n;
+  }
+
+  ESP_LOGI(TAG, "Connected to %s:%u", this->host_.c_str(), this->port_);
+  this->state_ = State::CONNECTED;
+  this->state_time_ = now;
+  this->reconnect_delay_ = 0;
+  this->rx_head_ = 0;
+  this->rx_len_ = 0;
+}
+
+void TcpTransport::disconnect(uint32_t now, const char *reason) {
+  ESP_LOGW(TAG, "Disconnected from %s:%u: %s", this->host_.c_str(), this->port_, reason);
+  if (this->socket_ != nullptr) {
+    this->socket_->close();
+    this->socket_.reset();
+  }
+  this->state_ = State::DISCONNECTED;
+  this->state_time_ = now;
+  this->reconnect_delay_ = this->reconnect_delay_ == 0
+                               ? RECONNECT_DELAY_MIN_MS
+                               : std::min(this->reconnect_delay_ * 2, RECONNECT_DELAY_MAX_MS);
+  this->rx_head_ = 0;
+  this->rx_len_ = 0;
+  this->tx_buf_.clear();
+}
+
+void TcpTransport::fill_rx_buffer() {
+  if (this->rx_head_ < this->rx_len_) {
+    return;
+  }
+  ssize_t n = this->socket_->read(this->rx_buf_, sizeof(this->rx_buf_));
+  if (n > 0) {
+    this->rx_head_ = 0;
+    this->rx_len_ = n;
+  } else if (n == 0 || !is_would_block(errno)) {
+    this->disconnect(millis(), n == 0 ? "closed by projector" : strerror(errno));
+  }
+}
+
+int TcpTransport::available() {
+  if (!this->is_connected()) {
+    return 0;
+  }
+  this->fill_rx_buffer();
+  return static_cast<int>(this->rx_len_ - this->rx_head_);
+}
+
+bool TcpTransport::read_byte(uint8_t *data) {
+  if (this->available() == 0) {
+    return false;
+  }
+  *data = this->rx_buf_[this->rx_head_++];
+  return true;
+}
+
+void TcpTransport::write_str(const char *str) {
+  if (!this->is_connected()) {
+    ESP_LOGW(TAG, "Not connected, dropping command");
+    return;
+  }
+  if (this->tx_buf_.size() + strlen(str) > TX_BUFFER_MAX) {
+    this->disconnect(millis(), "send buffer full");
+    return;
+  }
+  this->tx_buf_ += str;
+  this->flush_tx(millis());
+}
+
+// Writes what the socket will take now; the rest goes out from loop().
+void TcpTransport::flush_tx(uint32_t now) {
+  if (this->tx_buf_.empty()) {
+    return;
+  }
+  ssize_t written = this->socket_->write(this->tx_buf_.data(), this->tx_buf_.size());
+  if (written < 0) {
+    if (!is_would_block(errno)) {
+      this->disconnect(now, strerror(errno));
+    }
+    return;
+  }
+  this->tx_buf_.erase(0, written);
+}
+
+}  // namespace esphome::epson_projector
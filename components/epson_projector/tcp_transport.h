@@ -0,0 +1,67 @@
+#pragma once
+
+#include "esphome/components/socket/socket.h"
+
+#include "escvp_net.h"
+#include "transport.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace esphome::epson_projector {
+
+class TcpTransport : public Transport {
+ public:
+  void set_host(const std::string &host) { this->host_ = host; }
+  void set_port(uint16_t port) { this->port_ = port; }
+
+  void loop() override;
+  void dump_config() override;
+
+  [[nodiscard]] bool is_connected() const override { return this->state_ == State::CONNECTED; }
+  int available() override;
+  bool read_byte(uint8_t *data) override;
+  void write_str(const char *str) override;
+
+  static constexpr uint32_t CONNECT_TIMEOUT_MS = 5000;
+  static constexpr uint32_t RECONNECT_DELAY_MIN_MS = 1000;
+  static constexpr uint32_t RECONNECT_DELAY_MAX_MS = 30000;
+  // Bytes the socket has not taken yet. A projector that stops reading for this long is treated as gone.
+  static constexpr size_t TX_BUFFER_MAX = 256;
+
+ protected:
+  enum class State : uint8_t {
+    DISCONNECTED,
+    CONNECTING,
+    HANDSHAKE,
+    CONNECTED,
+  };
+
+  void start_connect(uint32_t now);
+  void poll_connecting(uint32_t now);
+  void poll_handshake(uint32_t now);
+  void disconnect(uint32_t now, const char *reason);
+  void fill_rx_buffer();
+  void flush_tx(uint32_t now);
+
+  std::string host_;
+  uint16_t port_{ESCVP_NET_PORT};
+  std::unique_ptr<socket::Socket> socket_;
+  State state_{State::DISCONNECTED};
+  uint32_t state_time_{0};
+  uint32_t reconnect_delay_{0};
+
+  uint8_t handshake_buf_[ESCVP_NET_HEADER_SIZE]{};
+  size_t handshake_len_{0};
+  size_t handshake_skip_{0};
+
+  uint8_t rx_buf_[64]{};
+  size_t rx_head_{0};
+  size_t rx_len_{0};
+
+  std::string tx_buf_;
+};
+
+}  // namespace esphome::epson_projector
@@ -20,7 +20,7 @@ TEXT_SENSOR_TYPES = {
 CONFIG_SCHEMA = projector_platform_schema(
     {
         cv.Optional(CONF_SERIAL_NUMBER): text_sensor.text_sensor_schema(
-            EpsonTextSensor,
+            EpsonTextSensor.template(TEXT_SENSOR_TYPES[CONF_SERIAL_NUMBER]),
             icon=ICON_SERIAL_NUMBER,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
@@ -31,9 +31,8 @@ CONFIG_SCHEMA = projector_platform_schema(
 async def to_code(config):
     parent = await get_projector_parent(config)
 
-    for key, sensor_type in TEXT_SENSOR_TYPES.items():
+    for key in TEXT_SENSOR_TYPES:
         if conf := config.get(key):
             sens = await text_sensor.new_text_sensor(conf)
             await cg.register_component(sens, conf)
             cg.add(sens.set_parent(parent))
-            cg.add(sens.set_text_sensor_type(sensor_type))
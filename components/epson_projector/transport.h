@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome::epson_projector {
+
+class Transport {
+ public:
+  virtual ~Transport() = default;
+
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+
+  [[nodiscard]] virtual bool is_connected() const { return true; }
+  virtual int available() = 0;
+  virtual bool read_byte(uint8_t *data) = 0;
+  virtual void write_str(const char *str) = 0;
+};
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,13 @@
+#include "uart_transport.h"
+
+#include "esphome/core/log.h"
+
+namespace esphome::epson_projector {
+
+static const char *const TAG = "epson_projector.uart";
+
+void UartTransport::dump_config() {
+  ESP_LOGCONFIG(TAG, "  Transport: UART");
+}
+
+}  // namespace esphome::epson_projector
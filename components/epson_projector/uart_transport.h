@@ -0,0 +1,18 @@
+#pragma once
+
+#include "esphome/components/uart/uart.h"
+
+#include "transport.h"
+
+namespace esphome::epson_projector {
+
+class UartTransport : public Transport, public uart::UARTDevice {
+ public:
+  void dump_config() override;
+
+  int available() override { return uart::UARTDevice::available(); }
+  bool read_byte(uint8_t *data) override { return uart::UARTDevice::read_byte(data); }
+  void write_str(const char *str) override { uart::UARTDevice::write_str(str); }
+};
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#include "protocol_constants.h"
+
+#include <array>
+#include <cstdint>
+
+namespace esphome::epson_projector {
+
+// Maps a 0..UiMax setting to the projector's 0..255 raw range and back. Both directions round to the
+// nearest step, so every UI value survives a write followed by a read unchanged. The tables are built
+// at compile time and the conversions are plain lookups. ESP8266 keeps constant data in RAM, so there
+// the conversions compute the same rounding directly instead of holding a 256-byte table per range.
+template <int UiMax>
+struct ValueScale {
+  static_assert(UiMax > 0 && UiMax <= PROJECTOR_RAW_MAX, "UI range must not be finer than the raw range");
+
+  static constexpr uint8_t compute_to_raw(int ui) {
+    return static_cast<uint8_t>((ui * PROJECTOR_RAW_MAX * 2 + UiMax) / (UiMax * 2));
+  }
+  static constexpr uint8_t compute_from_raw(int raw) {
+    return static_cast<uint8_t>((raw * UiMax * 2 + PROJECTOR_RAW_MAX) / (PROJECTOR_RAW_MAX * 2));
+  }
+
+  static constexpr std::array<uint8_t, UiMax + 1> TO_RAW = [] {
+    std::array<uint8_t, UiMax + 1> table{};
+    for (int ui = 0; ui <= UiMax; ui++) {
+      table[ui] = compute_to_raw(ui);
+    }
+    return table;
+  }();
+
+  static constexpr std::array<uint8_t, PROJECTOR_RAW_MAX + 1> FROM_RAW = [] {
+    std::array<uint8_t, PROJECTOR_RAW_MAX + 1> table{};
+    for (int raw = 0; raw <= PROJECTOR_RAW_MAX; raw++) {
+      table[raw] = compute_from_raw(raw);
+    }
+    return table;
+  }();
+
+  static constexpr int to_raw(int ui) {
+    ui = ui < 0 ? 0 : (ui > UiMax ? UiMax : ui);
+#ifdef USE_ESP8266
+    return compute_to_raw(ui);
+#else
+    return TO_RAW[ui];
+#endif
+  }
+  static constexpr int from_raw(int raw) {
+    raw = raw < 0 ? 0 : (raw > PROJECTOR_RAW_MAX ? PROJECTOR_RAW_MAX : raw);
+#ifdef USE_ESP8266
+    return compute_from_raw(raw);
+#else
+    return FROM_RAW[raw];
+#endif
+  }
+};
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,64 @@
+#include "wire_trace.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace esphome::epson_projector {
+
+std::string escape_wire_bytes(std::string_view bytes) {
+  std::string result;
+  result.reserve(bytes.size() + 8);
+  for (char c : bytes) {
+    if (c == '\\') {
+      result += "\\\\";
+    } else if (c == '\r') {
+      result += "\\r";
+    } else if (c == '\n') {
+      result += "\\n";
+    } else if (c < 32 || c > 126) {
+      char hex[8];
+      snprintf(hex, sizeof(hex), "\\x%02X", static_cast<unsigned char>(c));
+      result += hex;
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+std::string unescape_wire_bytes(std::string_view text) {
+  std::string result;
+  result.reserve(text.size());
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] != '\\' || i + 1 >= text.size()) {
+      result += text[i];
+      continue;
+    }
+    char next = text[++i];
+    if (next == 'r') {
+      result += '\r';
+    } else if (next == 'n') {
+      result += '\n';
+    } else if (next == 'x' && i + 2 < text.size()) {
+      result += static_cast<char>(std::strtoul(std::string(text.substr(i + 1, 2)).c_str(), nullptr, 16));
+      i += 2;
+    } else {
+      result += next;
+    }
+  }
+  return result;
+}
+
+std::string format_trace_frame(const TraceFrame &frame) {
+  char header[24];
+  snprintf(header, sizeof(header), "%u %s ", static_cast<unsigned>(frame.timestamp),
+           frame.direction == TraceDirection::TX ? "TX" : "RX");
+  std::string result = header;
+  result += escape_wire_bytes(frame.bytes());
+  if (frame.truncated) {
+    result += "...";
+  }
+  return result;
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "query_metadata.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace esphome::epson_projector {
+
+enum class TraceDirection : uint8_t {
+  TX,
+  RX,
+};
+
+struct TraceFrame {
+  static constexpr size_t DATA_SIZE = 32;
+
+  uint32_t timestamp;
+  TraceDirection direction;
+  uint8_t query;
+  uint8_t length;
+  bool truncated;
+  std::array<char, DATA_SIZE> data;
+
+  [[nodiscard]] std::string_view bytes() const { return {this->data.data(), this->length}; }
+};
+
+inline constexpr uint8_t TRACE_NO_QUERY = UINT8_MAX;
+
+std::string escape_wire_bytes(std::string_view bytes);
+std::string unescape_wire_bytes(std::string_view text);
+// One line of a session capture: "<millis> <TX|RX> <escaped bytes>".
+std::string format_trace_frame(const TraceFrame &frame);
+
+template <size_t N>
+class WireTrace {
+  static_assert(N > 0 && N <= UINT8_MAX, "Trace capacity must fit in a byte");
+
+ public:
+  void record(TraceDirection direction, uint32_t timestamp, const QueryInfo *info, std::string_view bytes) {
+    TraceFrame &frame = this->frames_[this->head_];
+    frame.timestamp = timestamp;
+    frame.direction = direction;
+    frame.query = info != nullptr ? static_cast<uint8_t>(info->type) : TRACE_NO_QUERY;
+    frame.length = static_cast<uint8_t>(std::min(bytes.size(), TraceFrame::DATA_SIZE));
+    frame.truncated = bytes.size() > TraceFrame::DATA_SIZE;
+    std::copy_n(bytes.begin(), frame.length, frame.data.begin());
+    this->head_ = (this->head_ + 1) % N;
+    if (this->count_ < N) {
+      this->count_++;
+    }
+  }
+
+  [[nodiscard]] size_t size() const { return this->count_; }
+  [[nodiscard]] static constexpr size_t capacity() { return N; }
+
+  // Oldest first.
+  [[nodiscard]] const TraceFrame &at(size_t index) const {
+    return this->frames_[(this->head_ + N - this->count_ + index) % N];
+  }
+
+  void clear() {
+    this->head_ = 0;
+    this->count_ = 0;
+  }
+
+ private:
+  std::array<TraceFrame, N> frames_{};
+  uint8_t head_{0};
+  uint8_t count_{0};
+};
+
+}  // namespace esphome::epson_projector
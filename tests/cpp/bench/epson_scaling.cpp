@@ -0,0 +1,290 @@
+// Host benchmark: how RAM and CPU grow with the number of projectors one controller serves.
+//
+// Each instance registers every query (standing in for a full entity set), gets one listener per query and talks
+// to a simulated projector that answers after a fixed latency. Simulated time advances by one tick plus the CPU
+// time the tick took, multiplied by --cpu-scale, so refresh latency reflects contention between links.
+// Sizes are for the host ABI; ESP32 pointers and std::string are smaller.
+
+#include "esphome/core/hal.h"
+
+#include "epson_projector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+
+size_t g_live_bytes = 0;
+size_t g_allocations = 0;
+
+constexpr size_t HEADER = alignof(std::max_align_t);
+
+}  // namespace
+
+void *operator new(size_t size) {
+  auto *block = static_cast<char *>(std::malloc(size + HEADER));
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  std::memcpy(block, &size, sizeof(size));
+  g_live_bytes += size;
+  g_allocations++;
+  return block + HEADER;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  char *block = static_cast<char *>(ptr) - HEADER;
+  size_t size;
+  std::memcpy(&size, block, sizeof(size));
+  g_live_bytes -= size;
+  std::free(block);
+}
+
+void operator delete(void *ptr, size_t /*size*/) noexcept { operator delete(ptr); }
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+constexpr uint32_t REPLY_LATENCY_MS = 40;
+constexpr uint32_t TICK_MS = 1;
+
+const char *canned_value(const std::string &key) {
+  static constexpr struct {
+    const char *key;
+    const char *value;
+  } VALUES[] = {
+      {CMD_POWER, "01"},     {CMD_LAMP, "1200"},      {CMD_ERROR, "00"},     {CMD_SERIAL, "X4KH8300123"},
+      {CMD_SOURCE, "30"},    {CMD_COLOR_MODE, "06"},  {CMD_ASPECT, "00"},    {CMD_LUMINANCE, "00"},
+      {CMD_GAMMA, "20"},     {CMD_MUTE, "OFF"},       {CMD_HREVERSE, "OFF"}, {CMD_VREVERSE, "OFF"},
+      {CMD_FREEZE, "OFF"},
+  };
+  for (const auto &entry : VALUES) {
+    if (key == entry.key) {
+      return entry.value;
+    }
+  }
+  return "128";
+}
+
+// Answers every query after REPLY_LATENCY_MS, like a powered-on projector on RS-232.
+class SimulatedLink : public Transport {
+ public:
+  int available() override {
+    this->release_due();
+    return static_cast<int>(this->rx_.size());
+  }
+  bool read_byte(uint8_t *data) override {
+    if (this->rx_.empty()) {
+      return false;
+    }
+    *data = this->rx_.front();
+    this->rx_.pop_front();
+    return true;
+  }
+  void write_str(const char *str) override {
+    std::string cmd(str);
+    std::string reply = ":";
+    if (cmd.size() > 2 && cmd[cmd.size() - 2] == '?') {
+      std::string key = cmd.substr(0, cmd.size() - 2);
+      reply = key + "=" + canned_value(key) + "\r:";
+    }
+    this->pending_.push_back({esphome::millis() + REPLY_LATENCY_MS, std::move(reply)});
+  }
+
+ private:
+  struct Reply {
+    uint32_t due;
+    std::string bytes;
+  };
+
+  void release_due() {
+    while (!this->pending_.empty() && esphome::millis() >= this->pending_.front().due) {
+      const auto &bytes = this->pending_.front().bytes;
+      this->rx_.insert(this->rx_.end(), bytes.begin(), bytes.end());
+      this->pending_.pop_front();
+    }
+  }
+
+  std::deque<Reply> pending_;
+  std::deque<uint8_t> rx_;
+};
+
+struct NullListener : StateListener {
+  void on_state_change() override { this->notified++; }
+  uint32_t notified{0};
+};
+
+struct Instance {
+  SimulatedLink link;
+  EpsonProjector projector;
+  std::array<NullListener, std::size(QUERY_TABLE)> listeners;
+  uint32_t refreshed_at{0};
+  bool refreshed{false};
+};
+
+struct Result {
+  size_t count{0};
+  size_t heap_after_setup{0};
+  size_t heap_after_refresh{0};
+  size_t allocations{0};
+  double loop_us_per_tick{0};
+  double update_us_per_call{0};
+  double refresh_mean_ms{0};
+  uint32_t refresh_max_ms{0};
+  size_t not_refreshed{0};
+};
+
+bool fully_refreshed(const EpsonProjector &projector) {
+  return std::ranges::all_of(QUERY_TABLE, [&projector](const QueryInfo &info) {
+    return !projector.has_query(info.type) || projector.is_confirmed(info.type);
+  });
+}
+
+double elapsed_us(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+Result run(size_t count, uint32_t duration_ms, double cpu_scale) {
+  Result result;
+  result.count = count;
+  esphome::MockClock::enabled = true;
+  esphome::MockClock::now = 0;
+
+  size_t link_heap = g_live_bytes;
+  auto probe = std::make_unique<SimulatedLink>();
+  link_heap = g_live_bytes - link_heap - sizeof(SimulatedLink);
+
+  size_t heap_before = g_live_bytes;
+  size_t allocations_before = g_allocations;
+  std::vector<std::unique_ptr<Instance>> instances;
+  instances.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    auto instance = std::make_unique<Instance>();
+    auto &projector = instance->projector;
+    projector.set_transport(&instance->link);
+    projector.set_restore_state(false);
+    for (const auto &info : QUERY_TABLE) {
+      projector.register_query(info.type);
+    }
+    for (auto &listener : instance->listeners) {
+      projector.add_listener(&listener);
+    }
+    projector.setup();
+    instances.push_back(std::move(instance));
+  }
+  size_t heap_instances =
+      sizeof(std::unique_ptr<Instance>) * instances.capacity() + (sizeof(Instance) + link_heap) * count;
+  result.heap_after_setup = g_live_bytes - heap_before - heap_instances;
+
+  double loop_us = 0;
+  double update_us = 0;
+  uint32_t ticks = 0;
+  uint32_t updates = 0;
+  uint32_t next_update = 0;
+  uint32_t update_interval = instances.front()->projector.get_update_interval();
+
+  while (esphome::MockClock::now < duration_ms) {
+    auto tick_start = std::chrono::steady_clock::now();
+    if (esphome::MockClock::now >= next_update) {
+      for (auto &instance : instances) {
+        auto start = std::chrono::steady_clock::now();
+        instance->projector.update();
+        update_us += elapsed_us(start);
+        updates++;
+      }
+      next_update += update_interval;
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (auto &instance : instances) {
+      instance->projector.loop();
+    }
+    loop_us += elapsed_us(start);
+    ticks++;
+    double tick_us = elapsed_us(tick_start);
+
+    for (auto &instance : instances) {
+      if (!instance->refreshed && fully_refreshed(instance->projector)) {
+        instance->refreshed = true;
+        instance->refreshed_at = esphome::MockClock::now;
+      }
+    }
+    esphome::MockClock::now += TICK_MS + static_cast<uint32_t>(tick_us * cpu_scale / 1000.0);
+  }
+
+  result.heap_after_refresh = g_live_bytes - heap_before - heap_instances;
+  result.allocations = g_allocations - allocations_before;
+  result.loop_us_per_tick = ticks > 0 ? loop_us / ticks : 0;
+  result.update_us_per_call = updates > 0 ? update_us / updates : 0;
+  uint64_t refresh_total = 0;
+  size_t refreshed = 0;
+  for (const auto &instance : instances) {
+    if (!instance->refreshed) {
+      result.not_refreshed++;
+      continue;
+    }
+    refresh_total += instance->refreshed_at;
+    refreshed++;
+    result.refresh_max_ms = std::max(result.refresh_max_ms, instance->refreshed_at);
+  }
+  result.refresh_mean_ms = refreshed > 0 ? static_cast<double>(refresh_total) / refreshed : 0;
+
+  instances.clear();
+  esphome::MockClock::enabled = false;
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::vector<size_t> counts;
+  uint32_t duration_ms = 30000;
+  double cpu_scale = 1.0;
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--duration") == 0 && i + 1 < argc) {
+      duration_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (std::strcmp(argv[i], "--cpu-scale") == 0 && i + 1 < argc) {
+      cpu_scale = std::strtod(argv[++i], nullptr);
+    } else {
+      counts.push_back(std::strtoul(argv[i], nullptr, 10));
+    }
+  }
+  if (counts.empty()) {
+    counts = {1, 4, 16, 64};
+  }
+
+  printf("sizeof(EpsonProjector): %zu bytes, CommandQueue: %zu, RxFramer: %zu, Command: %zu\n", sizeof(EpsonProjector),
+         sizeof(CommandQueue), sizeof(RxFramer), sizeof(Command));
+  printf("Simulated %u ms per run, reply latency %u ms, cpu scale %.1f\n\n", duration_ms, REPLY_LATENCY_MS,
+         cpu_scale);
+  printf("%6s %12s %12s %12s %14s %14s %16s %14s\n", "links", "heap/link", "heap/link", "allocs/link",
+         "loop us/tick", "update us", "refresh mean ms", "refresh max ms");
+  printf("%6s %12s %12s %12s %14s %14s %16s %14s\n", "", "(setup)", "(steady)", "", "", "(per call)", "", "");
+
+  int status = 0;
+  for (size_t count : counts) {
+    if (count == 0) {
+      continue;
+    }
+    Result r = run(count, duration_ms, cpu_scale);
+    printf("%6zu %12zu %12zu %12zu %14.2f %14.2f %16.1f %14u\n", r.count, r.heap_after_setup / r.count,
+           r.heap_after_refresh / r.count, r.allocations / r.count, r.loop_us_per_tick, r.update_us_per_call,
+           r.refresh_mean_ms, r.refresh_max_ms);
+    if (r.not_refreshed > 0) {
+      printf("       %zu links never completed a full refresh\n", r.not_refreshed);
+      status = 1;
+    }
+  }
+  return status;
+}
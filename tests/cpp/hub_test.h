@@ -0,0 +1,53 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "session_replay.h"
+
+#include <string>
+#include <vector>
+
+namespace esphome::epson_projector {
+
+// One hub on a ReplayTransport, driven by the mock clock. Derived fixtures adjust the hub in configure(),
+// which runs before setup().
+class HubTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    MockClock::enabled = true;
+    MockClock::now = 0;
+    this->projector_.set_transport(&this->transport_);
+    this->projector_.set_restore_state(false);
+    this->configure();
+    this->projector_.setup();
+  }
+
+  void TearDown() override { MockClock::enabled = false; }
+
+  virtual void configure() {}
+  virtual void run_loop() { this->projector_.loop(); }
+
+  // Confirms standby so the tests start with nothing on the wire.
+  void start_in_standby() {
+    this->transport_.deliver("PWR=00\r:");
+    this->projector_.loop();
+    this->transport_.take_sent();
+  }
+
+  // Advances the clock by a second, delivers the response and returns what the hub sent.
+  std::vector<std::string> step(const std::string &response = "") {
+    MockClock::now += 1000;
+    if (!response.empty()) {
+      this->transport_.deliver(response);
+    }
+    this->run_loop();
+    return this->transport_.take_sent();
+  }
+
+  ReplayTransport transport_;
+  EpsonProjector projector_;
+};
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace esphome::socket {
+
+class Socket {
+ public:
+  explicit Socket(int fd) : fd_(fd) {}
+  ~Socket() { this->close(); }
+  Socket(const Socket &) = delete;
+  Socket &operator=(const Socket &) = delete;
+
+  int connect(const struct sockaddr *addr, socklen_t addrlen) { return ::connect(this->fd_, addr, addrlen); }
+  int bind(const struct sockaddr *addr, socklen_t addrlen) { return ::bind(this->fd_, addr, addrlen); }
+  int listen(int backlog) { return ::listen(this->fd_, backlog); }
+  std::unique_ptr<Socket> accept(struct sockaddr *addr, socklen_t *addrlen) {
+    int fd = ::accept(this->fd_, addr, addrlen);
+    return fd < 0 ? nullptr : std::make_unique<Socket>(fd);
+  }
+  int getsockname(struct sockaddr *addr, socklen_t *addrlen) { return ::getsockname(this->fd_, addr, addrlen); }
+  ssize_t read(void *buf, size_t len) { return ::recv(this->fd_, buf, len, 0); }
+  ssize_t write(const void *buf, size_t len) { return ::send(this->fd_, buf, len, MSG_NOSIGNAL); }
+  int setsockopt(int level, int optname, const void *optval, socklen_t optlen) {
+    return ::setsockopt(this->fd_, level, optname, optval, optlen);
+  }
+  int setblocking(bool blocking) {
+    int flags = ::fcntl(this->fd_, F_GETFL, 0);
+    return ::fcntl(this->fd_, F_SETFL, blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK));
+  }
+  int close() {
+    if (this->fd_ < 0) {
+      return 0;
+    }
+    int ret = ::close(this->fd_);
+    this->fd_ = -1;
+    return ret;
+  }
+
+ private:
+  int fd_;
+};
+
+inline std::unique_ptr<Socket> socket_ip(int type, int protocol) {
+  int fd = ::socket(AF_INET, type, protocol);
+  return fd < 0 ? nullptr : std::make_unique<Socket>(fd);
+}
+
+inline socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::string &ip_address,
+                              uint16_t port) {
+  if (addrlen < sizeof(struct sockaddr_in)) {
+    return 0;
+  }
+  auto *server = reinterpret_cast<struct sockaddr_in *>(addr);
+  std::memset(server, 0, sizeof(*server));
+  server->sin_family = AF_INET;
+  server->sin_port = htons(port);
+  if (::inet_pton(AF_INET, ip_address.c_str(), &server->sin_addr) != 1) {
+    return 0;
+  }
+  return sizeof(struct sockaddr_in);
+}
+
+inline socklen_t set_sockaddr_any(struct sockaddr *addr, socklen_t addrlen, uint16_t port) {
+  if (addrlen < sizeof(struct sockaddr_in)) {
+    return 0;
+  }
+  auto *server = reinterpret_cast<struct sockaddr_in *>(addr);
+  std::memset(server, 0, sizeof(*server));
+  server->sin_family = AF_INET;
+  server->sin_port = htons(port);
+  server->sin_addr.s_addr = htonl(INADDR_ANY);
+  return sizeof(struct sockaddr_in);
+}
+
+}  // namespace esphome::socket
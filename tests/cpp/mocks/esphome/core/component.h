@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+
+namespace setup_priority {
+inline constexpr float DATA = 600.0f;
+inline constexpr float AFTER_WIFI = 250.0f;
+}  // namespace setup_priority
+
+class Component {
+ public:
+  virtual ~Component() = default;
+
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual void on_safe_shutdown() {}
+  virtual void on_shutdown() {}
+  virtual float get_setup_priority() const { return 0.0f; }
+
+  void mark_failed() { this->failed_ = true; }
+  [[nodiscard]] bool is_failed() const { return this->failed_; }
+
+ private:
+  bool failed_{false};
+};
+
+class PollingComponent : public Component {
+ public:
+  virtual void update() = 0;
+
+  void set_update_interval(uint32_t interval) { this->update_interval_ = interval; }
+  [[nodiscard]] uint32_t get_update_interval() const { return this->update_interval_; }
+
+ private:
+  uint32_t update_interval_{5000};
+};
+
+}  // namespace esphome
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace esphome {
+
+// Tests that need deterministic timing set enabled and drive now themselves.
+struct MockClock {
+  static inline bool enabled{false};
+  static inline uint32_t now{0};
+};
+
+inline uint32_t millis() {
+  if (MockClock::enabled) {
+    return MockClock::now;
+  }
+  using namespace std::chrono;
+  return static_cast<uint32_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+inline uint32_t micros() {
+  if (MockClock::enabled) {
+    return MockClock::now * 1000;
+  }
+  using namespace std::chrono;
+  return static_cast<uint32_t>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+}  // namespace esphome
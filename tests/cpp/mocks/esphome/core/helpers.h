@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define YESNO(b) ((b) ? "YES" : "NO")
+
+namespace esphome {
+
+inline uint32_t fnv1_hash(const std::string &str) {
+  uint32_t hash = 2166136261UL;
+  for (char c : str) {
+    hash *= 16777619UL;
+    hash ^= static_cast<uint8_t>(c);
+  }
+  return hash;
+}
+
+template <typename T>
+class FixedVector {
+ public:
+  void init(size_t size) { this->data_.reserve(size); }
+  void push_back(const T &value) { this->data_.push_back(value); }
+  [[nodiscard]] size_t size() const { return this->data_.size(); }
+  const T &operator[](size_t index) const { return this->data_[index]; }
+
+ private:
+  std::vector<T> data_;
+};
+
+}  // namespace esphome
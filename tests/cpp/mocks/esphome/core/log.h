@@ -0,0 +1,11 @@
+#pragma once
+
+__attribute__((format(printf, 1, 2))) inline void esp_log_mock(const char * /*format*/, ...) {}
+
+#define ESP_LOGE(tag, ...) ((void) (tag), esp_log_mock(__VA_ARGS__))
+#define ESP_LOGW(tag, ...) ((void) (tag), esp_log_mock(__VA_ARGS__))
+#define ESP_LOGI(tag, ...) ((void) (tag), esp_log_mock(__VA_ARGS__))
+#define ESP_LOGD(tag, ...) ((void) (tag), esp_log_mock(__VA_ARGS__))
+#define ESP_LOGV(tag, ...) ((void) (tag), esp_log_mock(__VA_ARGS__))
+#define ESP_LOGVV(tag, ...) ((void) (tag), esp_log_mock(__VA_ARGS__))
+#define ESP_LOGCONFIG(tag, ...) ((void) (tag), esp_log_mock(__VA_ARGS__))
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace esphome {
+
+class ESPPreferenceObject {
+ public:
+  ESPPreferenceObject() = default;
+  ESPPreferenceObject(std::vector<uint8_t> *storage, size_t size) : storage_(storage), size_(size) {}
+
+  template <typename T>
+  bool save(const T *src) {
+    if (this->storage_ == nullptr || sizeof(T) != this->size_) {
+      return false;
+    }
+    this->storage_->resize(sizeof(T));
+    std::memcpy(this->storage_->data(), src, sizeof(T));
+    return true;
+  }
+
+  template <typename T>
+  bool load(T *dest) {
+    if (this->storage_ == nullptr || this->storage_->size() != sizeof(T)) {
+      return false;
+    }
+    std::memcpy(dest, this->storage_->data(), sizeof(T));
+    return true;
+  }
+
+ private:
+  std::vector<uint8_t> *storage_{nullptr};
+  size_t size_{0};
+};
+
+class ESPPreferences {
+ public:
+  template <typename T>
+  ESPPreferenceObject make_preference(uint32_t type, bool /*in_flash*/ = false) {
+    return {&this->storage_[type], sizeof(T)};
+  }
+  bool sync() { return true; }
+  void reset() { this->storage_.clear(); }
+
+ private:
+  std::map<uint32_t, std::vector<uint8_t>> storage_;
+};
+
+inline ESPPreferences *global_preferences = new ESPPreferences();  // NOLINT
+
+}  // namespace esphome
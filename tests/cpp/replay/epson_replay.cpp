@@ -0,0 +1,77 @@
+#include "session_replay.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+const char *power_state_name(PowerState state) {
+  switch (state) {
+    case PowerState::STANDBY:
+      return "STANDBY";
+    case PowerState::ON:
+      return "ON";
+    case PowerState::WARMUP:
+      return "WARMUP";
+    case PowerState::COOLDOWN:
+      return "COOLDOWN";
+    case PowerState::UNKNOWN:
+      break;
+  }
+  return "UNKNOWN";
+}
+
+void print_report(const ReplayReport &report, const EpsonProjector &projector) {
+  printf("Frames:\n");
+  for (const auto &frame : report.frames) {
+    printf("  %10.1f ns  %-5s %s\n", frame.parse_ns, frame.parsed ? "ok" : "error",
+           escape_wire_bytes(frame.bytes).c_str());
+  }
+
+  printf("TX: %zu sent, %zu in capture, %zu mismatched\n", report.tx_sent, report.tx_expected,
+         report.tx_mismatches.size());
+  for (const auto &mismatch : report.tx_mismatches) {
+    printf("  #%zu expected %s, sent %s\n", mismatch.index, escape_wire_bytes(mismatch.expected).c_str(),
+           escape_wire_bytes(mismatch.actual).c_str());
+  }
+
+  double loop_mean = report.loop_iterations > 0 ? report.loop_total_us / report.loop_iterations : 0;
+  printf("Timing: %u ms simulated, %u loop() calls, mean %.2f us, max %.2f us\n", report.duration_ms,
+         report.loop_iterations, loop_mean, report.loop_max_us);
+
+  printf("Final state:\n");
+  printf("  Power: %s\n", power_state_name(projector.power_state()));
+  printf("  Link: %s\n", link_state_to_string(projector.link_state()));
+  printf("  Lamp hours: %u\n", projector.lamp_hours());
+  printf("  Error code: %u\n", projector.error_code());
+  printf("  Source: %s\n", projector.state().source.c_str());
+  printf("  Serial: %s\n", projector.state().serial_number.c_str());
+  for (const auto &info : QUERY_TABLE) {
+    if (projector.has_query(info.type)) {
+      printf("  %s?: %s\n", info.cmd, projector.is_confirmed(info.type) ? "confirmed" : "missing");
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <capture> [parse iterations]\n", argv[0]);
+    return 2;
+  }
+  auto capture = load_capture(argv[1]);
+  if (!capture) {
+    fprintf(stderr, "%s: %s\n", argv[1], capture.error().c_str());
+    return 1;
+  }
+  uint32_t iterations = argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 1000;
+
+  SessionReplay replay(std::move(*capture), iterations);
+  ReplayReport report = replay.run();
+  print_report(report, replay.projector());
+  return report.tx_mismatches.empty() ? 0 : 1;
+}
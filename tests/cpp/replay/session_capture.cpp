@@ -0,0 +1,111 @@
+#include "session_capture.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace esphome::epson_projector {
+
+namespace {
+
+compat::expected<uint32_t, std::string> parse_millis(const std::string &text) {
+  char *end = nullptr;
+  unsigned long value = std::strtoul(text.c_str(), &end, 10);
+  if (text.empty() || *end != '\0' || value > UINT32_MAX) {
+    return compat::unexpected("Invalid timestamp: " + text);
+  }
+  return static_cast<uint32_t>(value);
+}
+
+const QueryInfo *find_query_by_cmd(const std::string &cmd) {
+  auto it = std::ranges::find_if(QUERY_TABLE, [&cmd](const QueryInfo &info) { return cmd == info.cmd; });
+  return it == std::end(QUERY_TABLE) ? nullptr : &*it;
+}
+
+std::string line_error(size_t line_number, const std::string &message) {
+  return "line " + std::to_string(line_number) + ": " + message;
+}
+
+}  // namespace
+
+compat::expected<SessionCapture, std::string> parse_capture(std::istream &input) {
+  SessionCapture capture;
+  std::string line;
+  size_t line_number = 0;
+  uint32_t last_timestamp = 0;
+
+  while (std::getline(input, line)) {
+    line_number++;
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+    std::istringstream fields(line);
+    std::string first;
+    if (!(fields >> first) || first.front() == '#') {
+      continue;
+    }
+
+    if (first == "@update_interval") {
+      std::string value;
+      fields >> value;
+      auto interval = parse_millis(value);
+      if (!interval || *interval == 0) {
+        return compat::unexpected(line_error(line_number, "Invalid update interval"));
+      }
+      capture.update_interval = *interval;
+      continue;
+    }
+    if (first == "@query") {
+      std::string cmd;
+      while (fields >> cmd) {
+        const QueryInfo *info = find_query_by_cmd(cmd);
+        if (info == nullptr) {
+          return compat::unexpected(line_error(line_number, "Unknown query: " + cmd));
+        }
+        capture.queries.push_back(info->type);
+      }
+      continue;
+    }
+    if (first.front() == '@') {
+      return compat::unexpected(line_error(line_number, "Unknown directive: " + first));
+    }
+
+    auto timestamp = parse_millis(first);
+    if (!timestamp) {
+      return compat::unexpected(line_error(line_number, timestamp.error()));
+    }
+    if (*timestamp < last_timestamp) {
+      return compat::unexpected(line_error(line_number, "Timestamps must not go backwards"));
+    }
+    last_timestamp = *timestamp;
+
+    std::string direction;
+    fields >> direction;
+    CaptureEvent event{*timestamp, TraceDirection::TX, {}};
+    if (direction == "RX") {
+      event.direction = TraceDirection::RX;
+    } else if (direction != "TX") {
+      return compat::unexpected(line_error(line_number, "Expected TX or RX, got: " + direction));
+    }
+
+    std::string escaped;
+    std::getline(fields >> std::ws, escaped);
+    event.bytes = unescape_wire_bytes(escaped);
+    if (event.bytes.empty()) {
+      return compat::unexpected(line_error(line_number, "Frame has no bytes"));
+    }
+    capture.events.push_back(std::move(event));
+  }
+  return capture;
+}
+
+compat::expected<SessionCapture, std::string> load_capture(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    return compat::unexpected("Cannot open " + path);
+  }
+  return parse_capture(file);
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "cpp23_compat.h"
+#include "query_metadata.h"
+#include "wire_trace.h"
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace esphome::epson_projector {
+
+struct CaptureEvent {
+  uint32_t timestamp{0};
+  TraceDirection direction{TraceDirection::TX};
+  std::string bytes;
+};
+
+// A recorded UART session. Lines are either comments (#), directives (@update_interval <ms>,
+// @query <CMD>...) or frames in the wire trace format: "<millis> <TX|RX> <escaped bytes>".
+struct SessionCapture {
+  std::vector<CaptureEvent> events;
+  std::vector<QueryType> queries;
+  uint32_t update_interval{5000};
+};
+
+compat::expected<SessionCapture, std::string> parse_capture(std::istream &input);
+compat::expected<SessionCapture, std::string> load_capture(const std::string &path);
+
+}  // namespace esphome::epson_projector
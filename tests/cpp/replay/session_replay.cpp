@@ -0,0 +1,154 @@
+#include "session_replay.h"
+
+#include "esphome/core/hal.h"
+
+#include "response_parser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace esphome::epson_projector {
+
+namespace {
+
+constexpr size_t NO_ANCHOR = std::numeric_limits<size_t>::max();
+
+double elapsed_us(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+bool ReplayTransport::read_byte(uint8_t *data) {
+  if (this->rx_.empty()) {
+    return false;
+  }
+  *data = this->rx_.front();
+  this->rx_.pop_front();
+  return true;
+}
+
+std::vector<std::string> ReplayTransport::take_sent() {
+  std::vector<std::string> sent;
+  sent.swap(this->sent_);
+  return sent;
+}
+
+SessionReplay::SessionReplay(SessionCapture capture, uint32_t parse_iterations)
+    : capture_(std::move(capture)), parse_iterations_(std::max<uint32_t>(parse_iterations, 1)) {
+  MockClock::enabled = true;
+  MockClock::now = 0;
+
+  this->projector_.set_transport(&this->transport_);
+  this->projector_.set_restore_state(false);
+  this->projector_.set_update_interval(this->capture_.update_interval);
+  for (QueryType type : this->capture_.queries) {
+    this->projector_.register_query(type);
+  }
+
+  size_t anchor = NO_ANCHOR;
+  for (const auto &event : this->capture_.events) {
+    if (event.direction == TraceDirection::TX) {
+      anchor = this->report_.tx_expected++;
+      this->tx_events_.push_back(this->anchors_.size());
+    }
+    this->anchors_.push_back(anchor);
+  }
+}
+
+SessionReplay::~SessionReplay() {
+  MockClock::enabled = false;
+}
+
+ReplayReport SessionReplay::run() {
+  const auto &events = this->capture_.events;
+  uint32_t limit = (events.empty() ? 0 : events.back().timestamp) + SETTLE_LIMIT_MS;
+  uint32_t next_update = 0;
+
+  this->projector_.setup();
+  for (uint32_t now = 0; now <= limit; now++) {
+    MockClock::now = now;
+    if (now >= next_update) {
+      this->projector_.update();
+      next_update += this->capture_.update_interval;
+    }
+    this->deliver_due(now);
+
+    auto start = std::chrono::steady_clock::now();
+    this->projector_.loop();
+    double loop_us = elapsed_us(start);
+    this->report_.loop_iterations++;
+    this->report_.loop_total_us += loop_us;
+    this->report_.loop_max_us = std::max(this->report_.loop_max_us, loop_us);
+
+    this->record_sent(now);
+    this->report_.duration_ms = now;
+    if (this->next_event_ >= events.size() && this->replay_tx_time_.size() >= this->report_.tx_expected) {
+      break;
+    }
+  }
+  return this->report_;
+}
+
+void SessionReplay::deliver_due(uint32_t now) {
+  const auto &events = this->capture_.events;
+  while (this->next_event_ < events.size()) {
+    const auto &event = events[this->next_event_];
+    size_t anchor = this->anchors_[this->next_event_];
+
+    if (event.direction == TraceDirection::TX) {
+      if (this->replay_tx_time_.size() <= anchor) {
+        break;
+      }
+      this->next_event_++;
+      continue;
+    }
+
+    uint32_t due = event.timestamp;
+    if (anchor != NO_ANCHOR) {
+      if (this->replay_tx_time_.size() <= anchor) {
+        break;
+      }
+      const auto &anchor_event = events[this->tx_events_[anchor]];
+      due = this->replay_tx_time_[anchor] + (event.timestamp - anchor_event.timestamp);
+    }
+    if (now < due) {
+      break;
+    }
+
+    this->transport_.deliver(event.bytes);
+    this->report_.frames.push_back(this->measure_frame(event.bytes));
+    this->report_.rx_delivered++;
+    this->next_event_++;
+  }
+}
+
+void SessionReplay::record_sent(uint32_t now) {
+  const auto &events = this->capture_.events;
+  for (auto &sent : this->transport_.take_sent()) {
+    size_t index = this->replay_tx_time_.size();
+    this->replay_tx_time_.push_back(now);
+    this->report_.tx_sent++;
+    if (index >= this->report_.tx_expected) {
+      continue;
+    }
+    const auto &expected = events[this->tx_events_[index]].bytes;
+    if (sent != expected) {
+      this->report_.tx_mismatches.push_back({index, expected, sent});
+    }
+  }
+}
+
+FrameCost SessionReplay::measure_frame(const std::string &bytes) const {
+  ResponseParser parser;
+  FrameCost cost{bytes, 0, false};
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < this->parse_iterations_; i++) {
+    cost.parsed = parser.parse(bytes).has_value();
+  }
+  cost.parse_ns = elapsed_us(start) * 1000.0 / this->parse_iterations_;
+  return cost;
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "epson_projector.h"
+#include "session_capture.h"
+#include "transport.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace esphome::epson_projector {
+
+class ReplayTransport : public Transport {
+ public:
+  int available() override { return static_cast<int>(this->rx_.size()); }
+  bool read_byte(uint8_t *data) override;
+  void write_str(const char *str) override { this->sent_.emplace_back(str); }
+
+  void deliver(const std::string &bytes) { this->rx_.insert(this->rx_.end(), bytes.begin(), bytes.end()); }
+  std::vector<std::string> take_sent();
+
+ private:
+  std::deque<uint8_t> rx_;
+  std::vector<std::string> sent_;
+};
+
+struct FrameCost {
+  std::string bytes;
+  double parse_ns{0};
+  bool parsed{false};
+};
+
+struct TxMismatch {
+  size_t index{0};
+  std::string expected;
+  std::string actual;
+};
+
+struct ReplayReport {
+  std::vector<FrameCost> frames;
+  std::vector<TxMismatch> tx_mismatches;
+  size_t tx_expected{0};
+  size_t tx_sent{0};
+  size_t rx_delivered{0};
+  uint32_t duration_ms{0};
+  uint32_t loop_iterations{0};
+  double loop_total_us{0};
+  double loop_max_us{0};
+};
+
+// Drives an EpsonProjector through a capture on a simulated millisecond clock. Each RX frame is
+// anchored to the TX that preceded it in the capture, so replies arrive the same delay after the
+// replayed command was actually sent; frames recorded before any TX are delivered at their timestamp.
+class SessionReplay {
+ public:
+  explicit SessionReplay(SessionCapture capture, uint32_t parse_iterations = 1000);
+  ~SessionReplay();
+
+  ReplayReport run();
+  [[nodiscard]] const EpsonProjector &projector() const { return this->projector_; }
+
+  static constexpr uint32_t SETTLE_LIMIT_MS = 30000;
+
+ private:
+  void deliver_due(uint32_t now);
+  void record_sent(uint32_t now);
+  FrameCost measure_frame(const std::string &bytes) const;
+
+  SessionCapture capture_;
+  uint32_t parse_iterations_;
+  ReplayTransport transport_;
+  EpsonProjector projector_;
+  ReplayReport report_;
+  std::vector<size_t> anchors_;
+  std::vector<size_t> tx_events_;
+  std::vector<uint32_t> replay_tx_time_;
+  size_t next_event_{0};
+};
+
+}  // namespace esphome::epson_projector
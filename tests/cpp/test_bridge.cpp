@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "bridge_server.h"
+#include "hub_test.h"
+
+#include <sys/time.h>
+
+#include <string>
+#include <vector>
+
+using namespace esphome::epson_projector;
+
+class BridgeTest : public HubTest {
+ protected:
+  void SetUp() override {
+    HubTest::SetUp();
+    this->bridge_.setup();
+    ASSERT_NE(this->bridge_.port(), 0);
+  }
+
+  void TearDown() override {
+    for (int fd : this->clients_) {
+      ::close(fd);
+    }
+    this->bridge_.on_shutdown();
+    HubTest::TearDown();
+  }
+
+  int connect_client() {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(this->bridge_.port());
+    EXPECT_EQ(::connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)), 0);
+    struct timeval timeout {};
+    timeout.tv_sec = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    this->clients_.push_back(fd);
+    return fd;
+  }
+
+  static void send_line(int fd, const std::string &line) { ::send(fd, line.data(), line.size(), MSG_NOSIGNAL); }
+
+  static std::string receive(int fd) {
+    std::string reply;
+    char c;
+    while (::recv(fd, &c, 1, 0) == 1) {
+      reply += c;
+      if (c == ':') {
+        break;
+      }
+    }
+    return reply;
+  }
+
+  void run_loop() override {
+    this->projector_.loop();
+    this->bridge_.loop();
+    this->projector_.loop();
+  }
+
+  BridgeServer bridge_{&this->projector_, 0, 5000};
+  std::vector<int> clients_;
+};
+
+TEST_F(BridgeTest, ForwardsQueryAndRoutesReplyBack) {
+  int client = this->connect_client();
+  send_line(client, "SNO?\r");
+  EXPECT_EQ(this->step(), std::vector<std::string>{"SNO?\r"});
+  this->step("SNO=X4ABC123\r:");
+  EXPECT_EQ(receive(client), "SNO=X4ABC123\r:");
+  EXPECT_EQ(this->projector_.serial_number(), "X4ABC123");
+  EXPECT_EQ(this->bridge_.forwarded(), 1u);
+}
+
+TEST_F(BridgeTest, AnswersFreshQueriesFromCache) {
+  this->transport_.deliver("PWR=01\r:");
+  this->projector_.loop();
+  this->transport_.deliver("VOL=89\r:");
+  this->projector_.loop();
+
+  int client = this->connect_client();
+  send_line(client, "PWR?\r");
+  EXPECT_TRUE(this->step().empty());
+  EXPECT_EQ(receive(client), "PWR=01\r:");
+  send_line(client, "VOL?\r");
+  EXPECT_TRUE(this->step().empty());
+  EXPECT_EQ(receive(client), "VOL=89\r:");
+  EXPECT_EQ(this->bridge_.cache_hits(), 2u);
+
+  esphome::MockClock::now += 10000;
+  send_line(client, "PWR?\r");
+  EXPECT_EQ(this->step(), std::vector<std::string>{"PWR?\r"});
+}
+
+TEST_F(BridgeTest, AcknowledgedWriteUpdatesCache) {
+  this->transport_.deliver("PWR=01\r:");
+  this->projector_.loop();
+  int client = this->connect_client();
+  send_line(client, "VOL 64\r");
+  EXPECT_EQ(this->step(), std::vector<std::string>{"VOL 64\r"});
+  this->step(":");
+  EXPECT_EQ(receive(client), ":");
+  EXPECT_EQ(this->projector_.volume(), 5);
+
+  send_line(client, "VOL?\r");
+  EXPECT_TRUE(this->step().empty());
+  EXPECT_EQ(receive(client), "VOL=64\r:");
+}
+
+TEST_F(BridgeTest, CacheRepliesWithTheRawValueTheProjectorSent) {
+  this->transport_.deliver("PWR=01\r:");
+  this->projector_.loop();
+  this->transport_.deliver("BRIGHT=129\r:");
+  this->projector_.loop();
+
+  int client = this->connect_client();
+  send_line(client, "BRIGHT?\r");
+  EXPECT_TRUE(this->step().empty());
+  EXPECT_EQ(receive(client), "BRIGHT=129\r:");
+}
+
+TEST_F(BridgeTest, RemoteWriteInFlightBypassesCache) {
+  this->transport_.deliver("PWR=01\r:");
+  this->projector_.loop();
+  this->transport_.deliver("VOL=89\r:");
+  this->projector_.loop();
+
+  int writer = this->connect_client();
+  int reader = this->connect_client();
+  send_line(writer, "VOL 64\r");
+  EXPECT_EQ(this->step(), std::vector<std::string>{"VOL 64\r"});
+  EXPECT_TRUE(this->projector_.has_pending_write(QueryType::VOLUME));
+
+  send_line(reader, "VOL?\r");
+  EXPECT_TRUE(this->step().empty());
+  EXPECT_EQ(this->bridge_.cache_hits(), 0u);
+  EXPECT_EQ(this->step(":"), std::vector<std::string>{"VOL?\r"});
+  EXPECT_EQ(receive(writer), ":");
+  this->step("VOL=64\r:");
+  EXPECT_EQ(receive(reader), "VOL=64\r:");
+  EXPECT_EQ(this->bridge_.cache_hits(), 0u);
+}
+
+TEST_F(BridgeTest, ClientsTakeTurns) {
+  int first = this->connect_client();
+  int second = this->connect_client();
+  send_line(first, "SNO?\rSNO?\rSNO?\r");
+  send_line(second, "LAMP?\rLAMP?\rLAMP?\r");
+
+  std::vector<std::string> sent;
+  std::string reply;
+  for (int i = 0; i < 12 && sent.size() < 6; i++) {
+    for (const auto &cmd : this->step(reply)) {
+      sent.push_back(cmd);
+    }
+    reply.clear();
+    if (!sent.empty()) {
+      reply = sent.back() == "SNO?\r" ? "SNO=X1\r:" : "LAMP=100\r:";
+    }
+  }
+  ASSERT_EQ(sent.size(), 6u);
+  for (size_t i = 1; i < sent.size(); i++) {
+    EXPECT_NE(sent[i], sent[i - 1]) << "Command " << i << " went to the same client twice in a row";
+  }
+}
+
+TEST_F(BridgeTest, TimedOutCommandStillGetsReply) {
+  int client = this->connect_client();
+  send_line(client, "KEY 03\r");
+  this->step();
+  for (int i = 0; i < 20; i++) {
+    this->step();
+  }
+  EXPECT_EQ(receive(client), "ERR\r:");
+}
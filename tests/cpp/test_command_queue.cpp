@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 namespace esphome::epson_projector {
 
 class CommandQueueTest : public ::testing::Test {
@@ -105,6 +108,56 @@ TEST_F(CommandQueueTest, RetryStopsAtMaxRetries) {
   EXPECT_TRUE(queue.empty());
 }
 
+TEST_F(CommandQueueTest, RetryReportsWhetherRequeued) {
+  queue.set_pending(make_command("PWR?\r"));
+  EXPECT_TRUE(queue.retry_pending());
+
+  Command exhausted = make_command("LAMP?\r");
+  exhausted.retry_count = Command::MAX_RETRIES;
+  queue.set_pending(exhausted);
+  EXPECT_FALSE(queue.retry_pending());
+  EXPECT_TRUE(queue.has_pending_command());
+}
+
+TEST_F(CommandQueueTest, CancelIfRemovesMatchingAndFailsCallbacks) {
+  int failures = 0;
+  queue.enqueue(make_command("PWR?\r"));
+  queue.enqueue(Command{"VOL 10\r", CommandType::SET,
+                        [&failures](bool success, const std::string &) { failures += success ? 0 : 1; }, 0});
+  queue.enqueue(make_command("LAMP?\r"));
+
+  size_t cancelled = queue.cancel_if([](const Command &cmd) { return cmd.type == CommandType::SET; });
+
+  EXPECT_EQ(cancelled, 1u);
+  EXPECT_EQ(failures, 1);
+  EXPECT_EQ(queue.size(), 2u);
+  EXPECT_EQ(queue.dequeue()->command_str, "PWR?\r");
+  EXPECT_EQ(queue.dequeue()->command_str, "LAMP?\r");
+}
+
+TEST_F(CommandQueueTest, CancelIfLeavesPendingUntouched) {
+  queue.set_pending(make_command("PWR?\r"));
+  queue.enqueue(make_command("LAMP?\r"));
+
+  size_t cancelled = queue.cancel_if([](const Command &) { return true; });
+
+  EXPECT_EQ(cancelled, 1u);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_TRUE(queue.has_pending_command());
+}
+
+TEST_F(CommandQueueTest, ContainsIfMatchesQueuedQueryInfo) {
+  const QueryInfo *lamp = find_query_info(QueryType::LAMP_HOURS);
+  queue.enqueue(Command{"LAMP?\r", CommandType::QUERY, nullptr, 0, lamp});
+
+  EXPECT_TRUE(queue.contains_if([lamp](const Command &cmd) { return cmd.info == lamp; }));
+  EXPECT_FALSE(queue.contains_if(
+      [](const Command &cmd) { return cmd.info == find_query_info(QueryType::POWER); }));
+
+  queue.set_pending(*queue.dequeue());
+  EXPECT_FALSE(queue.contains_if([lamp](const Command &cmd) { return cmd.info == lamp; }));
+}
+
 TEST_F(CommandQueueTest, CommandWithCallback) {
   bool callback_called = false;
   std::string callback_response;
@@ -216,4 +269,59 @@ TEST_F(CommandQueueTest, RetryPreservesCallback) {
   EXPECT_TRUE(callback_called);
 }
 
+TEST_F(CommandQueueTest, DeferCoalescesWritesToSameSetting) {
+  std::vector<std::string> calls;
+  const QueryInfo *volume = find_query_info(QueryType::VOLUME);
+  queue.defer(Command{"VOL 89\r", CommandType::SET, [&calls](bool, const std::string &) { calls.push_back("first"); },
+                      0, volume});
+  queue.defer(Command{"VOL 102\r", CommandType::SET,
+                      [&calls](bool, const std::string &) { calls.push_back("second"); }, 0, volume});
+  EXPECT_EQ(queue.deferred_size(), 1u);
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_EQ(queue.release_deferred(), 1u);
+  auto cmd = queue.dequeue();
+  ASSERT_TRUE(cmd.has_value());
+  EXPECT_EQ(cmd->command_str, "VOL 102\r");
+  cmd->callback(true, "");
+  EXPECT_EQ(calls, (std::vector<std::string>{"first", "second"}));
+}
+
+TEST_F(CommandQueueTest, ReleaseDeferredGoesAheadOfQueueInOrder) {
+  queue.enqueue(make_command("LAMP?\r"));
+  queue.defer(Command{"SOURCE 30\r", CommandType::SET, nullptr, 0, find_query_info(QueryType::SOURCE)});
+  queue.defer(Command{"CMODE 06\r", CommandType::SET, nullptr, 0, find_query_info(QueryType::COLOR_MODE)});
+
+  EXPECT_EQ(queue.release_deferred(), 2u);
+  EXPECT_EQ(queue.deferred_size(), 0u);
+  EXPECT_EQ(queue.dequeue()->command_str, "SOURCE 30\r");
+  EXPECT_EQ(queue.dequeue()->command_str, "CMODE 06\r");
+  EXPECT_EQ(queue.dequeue()->command_str, "LAMP?\r");
+}
+
+TEST_F(CommandQueueTest, CoalescedWriteKeepsItsPlace) {
+  const QueryInfo *color_mode = find_query_info(QueryType::COLOR_MODE);
+  queue.defer(Command{"CMODE 06\r", CommandType::SET, nullptr, 0, color_mode});
+  queue.defer(Command{"BRIGHT 128\r", CommandType::SET, nullptr, 0, find_query_info(QueryType::BRIGHTNESS)});
+  queue.defer(Command{"CMODE 05\r", CommandType::SET, nullptr, 2, color_mode});
+
+  EXPECT_EQ(queue.release_deferred(), 2u);
+  auto first = queue.dequeue();
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(first->command_str, "CMODE 05\r");
+  EXPECT_EQ(first->retry_count, 0);
+  EXPECT_EQ(queue.dequeue()->command_str, "BRIGHT 128\r");
+}
+
+TEST_F(CommandQueueTest, CancelDeferredFailsCallbacks) {
+  int failures = 0;
+  queue.defer(Command{"MUTE ON\r", CommandType::SET,
+                      [&failures](bool success, const std::string &) { failures += success ? 0 : 1; }, 0,
+                      find_query_info(QueryType::MUTE)});
+
+  EXPECT_EQ(queue.cancel_deferred(), 1u);
+  EXPECT_EQ(failures, 1);
+  EXPECT_EQ(queue.deferred_size(), 0u);
+}
+
 }  // namespace esphome::epson_projector
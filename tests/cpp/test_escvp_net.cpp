@@ -0,0 +1,67 @@
+#include "escvp_net.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace esphome::epson_projector {
+
+namespace {
+
+std::array<uint8_t, ESCVP_NET_HEADER_SIZE> make_reply(uint8_t status, uint8_t field_count = 0) {
+  auto reply = build_escvp_net_connect();
+  reply[14] = status;
+  reply[15] = field_count;
+  return reply;
+}
+
+}  // namespace
+
+TEST(EscvpNetTest, ConnectRequestLayout) {
+  auto packet = build_escvp_net_connect();
+  EXPECT_EQ(std::memcmp(packet.data(), "ESC/VP.net", 10), 0);
+  EXPECT_EQ(packet[10], ESCVP_NET_VERSION);
+  EXPECT_EQ(packet[11], ESCVP_NET_TYPE_CONNECT);
+  for (size_t i = 12; i < packet.size(); ++i) {
+    EXPECT_EQ(packet[i], 0) << "byte " << i;
+  }
+}
+
+TEST(EscvpNetTest, ShortReplyIsIncomplete) {
+  auto reply = make_reply(ESCVP_NET_STATUS_OK);
+  EXPECT_EQ(parse_escvp_net_reply(reply.data(), reply.size() - 1).result, HandshakeResult::INCOMPLETE);
+  EXPECT_EQ(parse_escvp_net_reply(reply.data(), 0).result, HandshakeResult::INCOMPLETE);
+}
+
+TEST(EscvpNetTest, OkReplyIsAccepted) {
+  auto reply = make_reply(ESCVP_NET_STATUS_OK, 2);
+  auto parsed = parse_escvp_net_reply(reply.data(), reply.size());
+  EXPECT_EQ(parsed.result, HandshakeResult::ACCEPTED);
+  EXPECT_EQ(parsed.field_count, 2);
+}
+
+TEST(EscvpNetTest, ErrorStatusIsRejected) {
+  auto reply = make_reply(0x41);
+  auto parsed = parse_escvp_net_reply(reply.data(), reply.size());
+  EXPECT_EQ(parsed.result, HandshakeResult::REJECTED);
+  EXPECT_EQ(parsed.status, 0x41);
+  EXPECT_STREQ(escvp_net_status_to_string(parsed.status), "Password required");
+}
+
+TEST(EscvpNetTest, WrongMagicIsInvalid) {
+  auto reply = make_reply(ESCVP_NET_STATUS_OK);
+  reply[0] = 'X';
+  EXPECT_EQ(parse_escvp_net_reply(reply.data(), reply.size()).result, HandshakeResult::INVALID);
+}
+
+TEST(EscvpNetTest, WrongTypeIsInvalid) {
+  auto reply = make_reply(ESCVP_NET_STATUS_OK);
+  reply[11] = 0x01;
+  EXPECT_EQ(parse_escvp_net_reply(reply.data(), reply.size()).result, HandshakeResult::INVALID);
+}
+
+TEST(EscvpNetTest, UnknownStatusName) {
+  EXPECT_STREQ(escvp_net_status_to_string(0x99), "Unknown status");
+}
+
+}  // namespace esphome::epson_projector
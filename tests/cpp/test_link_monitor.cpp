@@ -0,0 +1,139 @@
+#include "link_monitor.h"
+
+#include <gtest/gtest.h>
+
+#include "hub_test.h"
+
+#include <string>
+#include <vector>
+
+namespace esphome::epson_projector {
+
+class LinkMonitorTest : public ::testing::Test {
+ protected:
+  LinkMonitor monitor;
+
+  void time_out(int count, uint32_t now = 0) {
+    for (int i = 0; i < count; ++i) {
+      monitor.record_timeout(now);
+    }
+  }
+};
+
+TEST_F(LinkMonitorTest, StartsUp) {
+  EXPECT_EQ(monitor.state(), LinkState::UP);
+  EXPECT_FALSE(monitor.is_down());
+  EXPECT_FALSE(monitor.probe_due(100000));
+}
+
+TEST_F(LinkMonitorTest, SingleTimeoutDegrades) {
+  EXPECT_TRUE(monitor.record_timeout(0));
+  EXPECT_EQ(monitor.state(), LinkState::DEGRADED);
+  EXPECT_EQ(monitor.consecutive_timeouts(), 1);
+}
+
+TEST_F(LinkMonitorTest, ThresholdTimeoutsGoDown) {
+  monitor.set_down_threshold(3);
+  time_out(2);
+  EXPECT_EQ(monitor.state(), LinkState::DEGRADED);
+  EXPECT_TRUE(monitor.record_timeout(0));
+  EXPECT_EQ(monitor.state(), LinkState::DOWN);
+}
+
+TEST_F(LinkMonitorTest, ThresholdOfOneSkipsDegraded) {
+  monitor.set_down_threshold(1);
+  EXPECT_TRUE(monitor.record_timeout(0));
+  EXPECT_EQ(monitor.state(), LinkState::DOWN);
+}
+
+TEST_F(LinkMonitorTest, ZeroThresholdClampedToOne) {
+  monitor.set_down_threshold(0);
+  EXPECT_EQ(monitor.down_threshold(), 1);
+}
+
+TEST_F(LinkMonitorTest, ResponseResetsDegraded) {
+  time_out(2);
+  EXPECT_TRUE(monitor.record_response());
+  EXPECT_EQ(monitor.state(), LinkState::UP);
+  EXPECT_EQ(monitor.consecutive_timeouts(), 0);
+}
+
+TEST_F(LinkMonitorTest, ResponseWhileUpReportsNoChange) {
+  EXPECT_FALSE(monitor.record_response());
+}
+
+TEST_F(LinkMonitorTest, ProbeDueAfterMinimumInterval) {
+  time_out(3, 1000);
+  EXPECT_FALSE(monitor.probe_due(1000 + LinkMonitor::PROBE_INTERVAL_MIN_MS - 1));
+  EXPECT_TRUE(monitor.probe_due(1000 + LinkMonitor::PROBE_INTERVAL_MIN_MS));
+}
+
+TEST_F(LinkMonitorTest, ProbeTimeoutsGrowInterval) {
+  time_out(3);
+  monitor.mark_probe_sent(0);
+  EXPECT_FALSE(monitor.record_timeout(0));
+  EXPECT_EQ(monitor.probe_interval(), LinkMonitor::PROBE_INTERVAL_MIN_MS * 2);
+  monitor.record_timeout(0);
+  EXPECT_EQ(monitor.probe_interval(), LinkMonitor::PROBE_INTERVAL_MIN_MS * 4);
+}
+
+TEST_F(LinkMonitorTest, ProbeIntervalCapped) {
+  time_out(3 + 20);
+  EXPECT_EQ(monitor.probe_interval(), LinkMonitor::PROBE_INTERVAL_MAX_MS);
+}
+
+TEST_F(LinkMonitorTest, RecoveryResetsProbeInterval) {
+  time_out(6);
+  EXPECT_TRUE(monitor.record_response());
+  EXPECT_EQ(monitor.state(), LinkState::UP);
+  EXPECT_EQ(monitor.probe_interval(), LinkMonitor::PROBE_INTERVAL_MIN_MS);
+  EXPECT_FALSE(monitor.probe_due(UINT32_MAX));
+}
+
+TEST_F(LinkMonitorTest, ProbeDueHandlesMillisWraparound) {
+  time_out(3, UINT32_MAX - 1000);
+  EXPECT_FALSE(monitor.probe_due(UINT32_MAX));
+  EXPECT_TRUE(monitor.probe_due(LinkMonitor::PROBE_INTERVAL_MIN_MS));
+}
+
+TEST_F(LinkMonitorTest, StateNames) {
+  EXPECT_STREQ(link_state_to_string(LinkState::UP), "UP");
+  EXPECT_STREQ(link_state_to_string(LinkState::DEGRADED), "DEGRADED");
+  EXPECT_STREQ(link_state_to_string(LinkState::DOWN), "DOWN");
+}
+
+class HubLinkDownTest : public HubTest {
+ protected:
+  std::vector<std::string> run_until_down() {
+    std::vector<std::string> sent;
+    for (int i = 0; i < 30 && this->projector_.is_link_up(); i++) {
+      for (auto &cmd : this->step()) {
+        sent.push_back(cmd);
+      }
+    }
+    return sent;
+  }
+};
+
+TEST_F(HubLinkDownTest, WritesFailAndOnlyProbesAreSent) {
+  this->transport_.deliver("PWR=01\r:");
+  this->projector_.loop();
+  this->projector_.set_volume(5, true);
+  this->projector_.set_mute(true, true);
+  this->projector_.set_brightness(20, true);
+  this->run_until_down();
+  ASSERT_FALSE(this->projector_.is_link_up());
+  EXPECT_FALSE(this->projector_.has_pending_write(QueryType::VOLUME));
+  EXPECT_FALSE(this->projector_.has_pending_write(QueryType::MUTE));
+  EXPECT_FALSE(this->projector_.has_pending_write(QueryType::BRIGHTNESS));
+
+  this->projector_.set_volume(7, true);
+  EXPECT_FALSE(this->projector_.has_pending_write(QueryType::VOLUME));
+  std::vector<std::string> sent;
+  for (int i = 0; i < 10 && sent.empty(); i++) {
+    sent = this->step();
+  }
+  EXPECT_EQ(sent, std::vector<std::string>{"PWR?\r"});
+}
+
+}  // namespace esphome::epson_projector
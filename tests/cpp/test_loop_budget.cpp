@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "hub_test.h"
+#include "loop_budget.h"
+
+using namespace esphome::epson_projector;
+
+TEST(LoopBudgetTest, StopsAtByteLimit) {
+  LoopBudget budget(0, 0, 2);
+  EXPECT_TRUE(budget.take_byte(0));
+  EXPECT_TRUE(budget.take_byte(0));
+  EXPECT_FALSE(budget.exhausted());
+  EXPECT_FALSE(budget.take_byte(0));
+  EXPECT_TRUE(budget.exhausted());
+}
+
+TEST(LoopBudgetTest, StopsWhenTimeRunsOut) {
+  LoopBudget budget(1000, 500, 64);
+  EXPECT_TRUE(budget.take_byte(1499));
+  EXPECT_FALSE(budget.take_byte(1500));
+  EXPECT_TRUE(budget.exhausted());
+}
+
+TEST(LoopBudgetTest, ZeroTimeMeansOnlyBytesCount) {
+  LoopBudget budget(0, 0, 1);
+  EXPECT_TRUE(budget.take_byte(UINT32_MAX));
+}
+
+TEST(LoopBudgetTest, TimeWindowSurvivesMicrosWrap) {
+  LoopBudget budget(UINT32_MAX - 100, 500, 64);
+  EXPECT_TRUE(budget.take_byte(200));
+  EXPECT_FALSE(budget.take_byte(400));
+}
+
+struct CountingListener : StateListener {
+  void on_state_change() override { this->count++; }
+  int count{0};
+};
+
+class ProjectorLoopBudgetTest : public HubTest {
+ protected:
+  void configure() override { this->projector_.add_listener(&this->listener_); }
+
+  CountingListener listener_;
+};
+
+TEST_F(ProjectorLoopBudgetTest, CarriesUnreadBytesToNextIteration) {
+  this->projector_.set_rx_bytes_per_loop(8);
+  this->transport_.deliver("PWR=01\r:LAMP=1200\r:");
+
+  this->projector_.loop();
+  EXPECT_EQ(this->projector_.power_state(), PowerState::ON);
+  EXPECT_EQ(this->transport_.available(), 11);
+  EXPECT_EQ(this->listener_.count, 0);
+
+  this->projector_.loop();
+  EXPECT_EQ(this->projector_.lamp_hours(), 0u);
+  EXPECT_EQ(this->listener_.count, 0);
+
+  this->projector_.loop();
+  EXPECT_EQ(this->transport_.available(), 0);
+  EXPECT_EQ(this->projector_.lamp_hours(), 1200u);
+  EXPECT_EQ(this->listener_.count, 1);
+}
+
+TEST_F(ProjectorLoopBudgetTest, CoalescesNotificationsPerIteration) {
+  this->transport_.deliver("PWR=01\r:LAMP=1200\r:ERR=00\r:");
+  this->projector_.loop();
+  EXPECT_EQ(this->listener_.count, 1);
+
+  this->projector_.loop();
+  EXPECT_EQ(this->listener_.count, 1);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include "query_metadata.h"
+
+#define EPSON_PROJECTOR_MODEL_NAME "Epson EB-U42"
+#define EPSON_PROJECTOR_UNSUPPORTED_QUERIES (query_bit(QueryType::LUMINANCE) | query_bit(QueryType::GAMMA))
+#define EPSON_PROJECTOR_USED_QUERIES \
+  (query_bit(QueryType::SOURCE) | query_bit(QueryType::BRIGHTNESS) | query_bit(QueryType::GAMMA))
+#include "model_capabilities.h"
+
+using namespace esphome::epson_projector;
+
+TEST(ModelCapabilitiesTest, QueryBitsMatchEnumOrder) {
+  EXPECT_EQ(query_bit(QueryType::POWER), 1u);
+  EXPECT_EQ(query_bit(QueryType::LAMP_HOURS), 2u);
+  EXPECT_EQ(query_bit(QueryType::SERIAL_NUMBER), 1u << 21);
+}
+
+TEST(ModelCapabilitiesTest, GeneratedDefinesAreApplied) {
+  EXPECT_STREQ(MODEL_NAME, "Epson EB-U42");
+  static_assert(!model_supports(QueryType::LUMINANCE));
+  static_assert(!model_supports(QueryType::GAMMA));
+  static_assert(model_supports(QueryType::POWER));
+  static_assert(model_supports(QueryType::BRIGHTNESS));
+}
+
+TEST(ModelCapabilitiesTest, EveryQueryFitsTheMask) {
+  for (const auto &info : QUERY_TABLE) {
+    EXPECT_NE(query_bit(info.type), 0u) << info.cmd;
+  }
+}
+
+TEST(ModelCapabilitiesTest, OnlyUsedQueriesAreCompiledIn) {
+  static_assert(query_compiled_in(QueryType::POWER), "Power is always compiled in");
+  static_assert(query_compiled_in(QueryType::SOURCE));
+  static_assert(query_compiled_in(QueryType::BRIGHTNESS));
+  static_assert(!query_compiled_in(QueryType::VOLUME));
+  static_assert(!query_compiled_in(QueryType::GAMMA), "Used but unsupported by the model");
+}
+
+namespace {
+
+struct TestEntry {
+  QueryType type;
+  int value;
+};
+
+constexpr TestEntry ALL_TEST_ENTRIES[] = {
+    {QueryType::VOLUME, 1},
+    {QueryType::SOURCE, 2},
+    {QueryType::GAMMA, 3},
+    {QueryType::BRIGHTNESS, 4},
+};
+
+}  // namespace
+
+TEST(ModelCapabilitiesTest, CompiledEntriesKeepsOnlyCompiledQueries) {
+  constexpr auto entries = compiled_entries<ALL_TEST_ENTRIES>();
+  static_assert(entries.size() == 2);
+  EXPECT_EQ(entries[0].value, 2);
+  EXPECT_EQ(entries[1].value, 4);
+
+  constexpr auto everything = compiled_entries<ALL_TEST_ENTRIES, UINT32_MAX>();
+  static_assert(everything.size() == 4);
+  constexpr auto nothing = compiled_entries<ALL_TEST_ENTRIES, 0>();
+  static_assert(nothing.empty());
+}
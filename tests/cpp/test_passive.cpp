@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "command_tap.h"
+#include "hub_test.h"
+
+#include <string>
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+std::string push_all(CommandTap &tap, const std::string &bytes) {
+  std::string last;
+  for (char c : bytes) {
+    if (tap.push(static_cast<uint8_t>(c))) {
+      last = tap.line();
+    }
+  }
+  return last;
+}
+
+}  // namespace
+
+TEST(CommandTapTest, SplitsCommandsAtCarriageReturn) {
+  CommandTap tap;
+  EXPECT_EQ(push_all(tap, "PWR?\r"), "PWR?");
+  EXPECT_EQ(push_all(tap, "VOL 89\r\n"), "VOL 89");
+  EXPECT_EQ(push_all(tap, "SOURCE"), "");
+  EXPECT_EQ(push_all(tap, " 30\r"), "SOURCE 30");
+}
+
+TEST(CommandTapTest, DropsOverlongCommandUpToNextCarriageReturn) {
+  CommandTap tap;
+  EXPECT_EQ(push_all(tap, std::string(CommandTap::CAPACITY + 10, 'A') + "\r"), "");
+  EXPECT_EQ(tap.overflows(), 1u);
+  EXPECT_EQ(push_all(tap, "MUTE?\r"), "MUTE?");
+}
+
+TEST(CommandTapTest, ParsesQueriesAndWrites) {
+  auto query = parse_observed_command("SOURCE?");
+  ASSERT_TRUE(query.has_value());
+  EXPECT_EQ(query->key, "SOURCE");
+  EXPECT_TRUE(query->is_query);
+
+  auto write = parse_observed_command(" VOL 89 ");
+  ASSERT_TRUE(write.has_value());
+  EXPECT_EQ(write->key, "VOL");
+  EXPECT_EQ(write->value, "89");
+  EXPECT_FALSE(write->is_query);
+
+  EXPECT_FALSE(parse_observed_command("").has_value());
+  EXPECT_FALSE(parse_observed_command(" ?").has_value());
+}
+
+// transport_ carries the projector's replies; commands_ taps the other controller's line.
+class PassiveTest : public HubTest {
+ protected:
+  void configure() override {
+    this->projector_.set_command_tap(&this->commands_);
+    this->projector_.set_passive(true);
+    this->projector_.register_query(QueryType::POWER);
+    this->projector_.register_query(QueryType::VOLUME);
+    this->projector_.register_query(QueryType::SOURCE);
+  }
+
+  void exchange(const std::string &command, const std::string &reply) {
+    esphome::MockClock::now += 100;
+    this->commands_.deliver(command);
+    this->transport_.deliver(reply);
+    this->projector_.update();
+    this->projector_.loop();
+    EXPECT_TRUE(this->transport_.take_sent().empty()) << "Transmitted after " << command;
+  }
+
+  ReplayTransport commands_;
+};
+
+TEST_F(PassiveTest, DecodesObservedQueries) {
+  this->exchange("PWR?\r", "PWR=01\r:");
+  this->exchange("SOURCE?\r", "SOURCE=30\r:");
+  this->exchange("VOL?\r", "VOL=89\r:");
+
+  EXPECT_EQ(this->projector_.power_state(), PowerState::ON);
+  EXPECT_EQ(this->projector_.current_source(), "30");
+  EXPECT_EQ(this->projector_.volume(), 7);
+  EXPECT_TRUE(this->projector_.is_confirmed(QueryType::VOLUME));
+}
+
+TEST_F(PassiveTest, AppliesAcknowledgedWrites) {
+  this->exchange("PWR?\r", "PWR=01\r:");
+  this->exchange("VOL 64\r", ":");
+  EXPECT_EQ(this->projector_.volume(), 5);
+
+  this->exchange("SOURCE A0\r", "ERR\r:");
+  EXPECT_EQ(this->projector_.current_source(), "");
+
+  this->exchange("VOL INC\r", ":");
+  EXPECT_EQ(this->projector_.volume(), 5);
+
+  this->exchange("PWR OFF\r", ":");
+  EXPECT_EQ(this->projector_.power_state(), PowerState::COOLDOWN);
+}
+
+TEST_F(PassiveTest, MatchesRepliesReadInTheSamePass) {
+  esphome::MockClock::now += 100;
+  this->commands_.deliver("PWR?\rVOL 64\rSOURCE?\r");
+  this->transport_.deliver("PWR=01\r::SOURCE=41\r:");
+  this->projector_.loop();
+
+  EXPECT_EQ(this->projector_.power_state(), PowerState::ON);
+  EXPECT_EQ(this->projector_.volume(), 5);
+  EXPECT_EQ(this->projector_.current_source(), "41");
+}
+
+TEST_F(PassiveTest, NeverTransmits) {
+  this->exchange("PWR?\r", "PWR=01\r:");
+  this->projector_.set_volume(12, true);
+  this->projector_.set_power(false, true);
+  for (int i = 0; i < 20; i++) {
+    esphome::MockClock::now += 5000;
+    this->projector_.update();
+    this->projector_.loop();
+  }
+  EXPECT_TRUE(this->transport_.take_sent().empty());
+  EXPECT_TRUE(this->commands_.take_sent().empty());
+  EXPECT_EQ(this->projector_.power_state(), PowerState::ON);
+  EXPECT_NE(this->projector_.volume(), 12);
+}
@@ -0,0 +1,121 @@
+#include "persisted_state.h"
+
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+#include "esphome/core/preferences.h"
+
+#include "epson_projector.h"
+#include "session_replay.h"
+
+#include <string>
+
+namespace esphome::epson_projector {
+
+TEST(PersistedStateTest, FitsPreferenceBudget) {
+  EXPECT_LE(sizeof(PersistedState), 64u);
+}
+
+TEST(PersistedStateTest, StoreFixedRoundTrip) {
+  char code[PERSISTED_CODE_SIZE];
+  store_fixed(code, "A0");
+  EXPECT_EQ(load_fixed(code), "A0");
+}
+
+TEST(PersistedStateTest, StoreFixedUsesFullCapacity) {
+  char code[PERSISTED_CODE_SIZE];
+  store_fixed(code, "1234");
+  EXPECT_EQ(load_fixed(code), "1234");
+}
+
+TEST(PersistedStateTest, StoreFixedTruncatesLongValues) {
+  char code[PERSISTED_CODE_SIZE];
+  store_fixed(code, "ABCDEFGH");
+  EXPECT_EQ(load_fixed(code), "ABCD");
+}
+
+TEST(PersistedStateTest, StoreFixedZeroFillsTail) {
+  char code[PERSISTED_CODE_SIZE];
+  std::memset(code, 'x', sizeof(code));
+  store_fixed(code, "1");
+  for (size_t i = 1; i < sizeof(code); ++i) {
+    EXPECT_EQ(code[i], '\0') << "byte " << i;
+  }
+}
+
+TEST(PersistedStateTest, StoreFixedEmptyString) {
+  char serial[PERSISTED_SERIAL_SIZE];
+  store_fixed(serial, "");
+  EXPECT_EQ(load_fixed(serial), "");
+}
+
+TEST(PersistedStateTest, LoadFixedWithoutTerminator) {
+  char code[PERSISTED_CODE_SIZE] = {'1', '2', '3', '4', '5'};
+  EXPECT_EQ(load_fixed(code), "12345");
+}
+
+TEST(PersistedStateTest, VersionCompatibility) {
+  PersistedState state{};
+  EXPECT_FALSE(is_compatible(state));
+  state.version = PERSISTED_STATE_VERSION;
+  EXPECT_TRUE(is_compatible(state));
+  state.version = PERSISTED_STATE_VERSION + 1;
+  EXPECT_FALSE(is_compatible(state));
+}
+
+namespace {
+
+void run_hub(const std::string &hub_id, const std::string &source) {
+  ReplayTransport transport;
+  EpsonProjector projector;
+  projector.set_transport(&transport);
+  projector.set_state_key(hub_id);
+  projector.setup();
+  transport.deliver("PWR=01\r:SOURCE=" + source + "\r:");
+  projector.loop();
+  projector.on_safe_shutdown();
+}
+
+PowerState restored_power(const std::string &hub_id) {
+  ReplayTransport transport;
+  EpsonProjector projector;
+  projector.set_transport(&transport);
+  projector.set_state_key(hub_id);
+  projector.setup();
+  EXPECT_FALSE(projector.has_received(QueryType::POWER));
+  return projector.power_state();
+}
+
+std::string restored_source(const std::string &hub_id) {
+  ReplayTransport transport;
+  EpsonProjector projector;
+  projector.set_transport(&transport);
+  projector.set_state_key(hub_id);
+  projector.setup();
+  return std::string(projector.current_source());
+}
+
+}  // namespace
+
+TEST(PersistedStateTest, HubsKeepSeparateSlots) {
+  MockClock::enabled = true;
+  MockClock::now = 0;
+  global_preferences->reset();
+  run_hub("living_room", "30");
+  run_hub("bedroom", "A0");
+  EXPECT_EQ(restored_source("living_room"), "30");
+  EXPECT_EQ(restored_source("bedroom"), "A0");
+  MockClock::enabled = false;
+}
+
+TEST(PersistedStateTest, PowerIsNotRestored) {
+  MockClock::enabled = true;
+  MockClock::now = 0;
+  global_preferences->reset();
+  run_hub("living_room", "30");
+  EXPECT_EQ(restored_power("living_room"), PowerState::UNKNOWN);
+  EXPECT_EQ(restored_source("living_room"), "30");
+  MockClock::enabled = false;
+}
+
+}  // namespace esphome::epson_projector
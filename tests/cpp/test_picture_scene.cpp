@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "hub_test.h"
+#include "picture_scene.h"
+#include "session_replay.h"
+#include "value_scale.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+PictureScene night_scene() {
+  PictureScene scene;
+  scene.name = "night";
+  scene.color_mode = "06";
+  scene.gamma = "22";
+  scene.brightness = 40;
+  scene.contrast = 55;
+  return scene;
+}
+
+}  // namespace
+
+TEST(PictureSceneTest, EmptyWhenCurrentMatchesTarget) {
+  PictureScene current = night_scene();
+  current.name.clear();
+  EXPECT_TRUE(diff_scene(night_scene(), current).empty());
+}
+
+TEST(PictureSceneTest, OnlyChangedFieldsAreWritten) {
+  PictureScene current = night_scene();
+  current.name.clear();
+  current.brightness = 70;
+  EXPECT_EQ(diff_scene(night_scene(), current), std::vector<SceneField>{SceneField::BRIGHTNESS});
+}
+
+TEST(PictureSceneTest, UnknownCurrentValuesAreWritten) {
+  PictureScene current;
+  current.color_mode = "06";
+  current.gamma = "22";
+  std::vector<SceneField> expected{SceneField::BRIGHTNESS, SceneField::CONTRAST};
+  EXPECT_EQ(diff_scene(night_scene(), current), expected);
+}
+
+TEST(PictureSceneTest, FieldsNotInSceneAreIgnored) {
+  PictureScene target;
+  target.name = "bright";
+  target.brightness = 90;
+  PictureScene current;
+  current.color_mode = "06";
+  current.brightness = 90;
+  current.sharpness = 3;
+  current.tint = 50;
+  EXPECT_TRUE(diff_scene(target, current).empty());
+}
+
+TEST(PictureSceneTest, ColorModeChangeRewritesEverythingInOrder) {
+  PictureScene current = night_scene();
+  current.name.clear();
+  current.color_mode = "0C";
+  std::vector<SceneField> expected{SceneField::COLOR_MODE, SceneField::GAMMA, SceneField::BRIGHTNESS,
+                                   SceneField::CONTRAST};
+  EXPECT_EQ(diff_scene(night_scene(), current), expected);
+}
+
+TEST(PictureSceneTest, AllFieldsFollowDependencyOrder) {
+  PictureScene target{
+      .name = "full",
+      .color_mode = "06",
+      .luminance = "01",
+      .gamma = "22",
+      .brightness = 1,
+      .contrast = 2,
+      .sharpness = 3,
+      .density = 4,
+      .tint = 5,
+      .color_temp = 6,
+  };
+  std::vector<SceneField> expected{
+      SceneField::COLOR_MODE, SceneField::LUMINANCE, SceneField::GAMMA,   SceneField::BRIGHTNESS,
+      SceneField::CONTRAST,   SceneField::SHARPNESS, SceneField::DENSITY, SceneField::TINT,
+      SceneField::COLOR_TEMP,
+  };
+  EXPECT_EQ(diff_scene(target, PictureScene{}), expected);
+}
+
+TEST(PictureSceneApplyTest, ForcedFieldsAreTransmitted) {
+  esphome::MockClock::enabled = true;
+  esphome::MockClock::now = 0;
+  ReplayTransport transport;
+  EpsonProjector projector;
+  projector.set_transport(&transport);
+  projector.set_restore_state(false);
+  projector.setup();
+  std::string brightness = std::to_string(ValueScale<BRIGHTNESS_MAX>::to_raw(40));
+  transport.deliver("PWR=01\r:CMODE=0C\r:BRIGHT=" + brightness + "\r:");
+  projector.loop();
+
+  PictureScene scene;
+  scene.name = "night";
+  scene.color_mode = "06";
+  scene.brightness = 40;
+  projector.add_scene(scene);
+  PictureScene current;
+  current.color_mode = "0C";
+  current.brightness = 40;
+  ASSERT_EQ(diff_scene(scene, current).size(), 2u);
+  ASSERT_TRUE(projector.apply_scene("night"));
+
+  std::vector<std::string> sent;
+  for (int i = 0; i < 10; i++) {
+    esphome::MockClock::now += 1000;
+    projector.loop();
+    for (auto &cmd : transport.take_sent()) {
+      sent.push_back(cmd);
+      transport.deliver(":");
+    }
+  }
+  std::vector<std::string> expected{"CMODE 06\r", "BRIGHT " + brightness + "\r"};
+  EXPECT_EQ(sent, expected);
+  esphome::MockClock::enabled = false;
+}
+
+class ColorModeChangeTest : public HubTest {
+ protected:
+  void configure() override {
+    this->projector_.register_query(QueryType::COLOR_MODE);
+    this->projector_.register_query(QueryType::BRIGHTNESS);
+    this->projector_.register_query(QueryType::GAMMA);
+  }
+
+  // Answers every query with a fixed value and every write with a prompt, returning what was sent.
+  std::vector<std::string> answer_all(int steps) {
+    std::vector<std::string> sent;
+    std::string reply;
+    for (int i = 0; i < steps; i++) {
+      for (const auto &cmd : this->step(reply)) {
+        sent.push_back(cmd);
+      }
+      reply.clear();
+      if (!sent.empty()) {
+        const std::string &last = sent.back();
+        reply = last.ends_with("?\r") ? last.substr(0, last.size() - 2) + "=" + this->value_of(last) + "\r:" : ":";
+      }
+    }
+    return sent;
+  }
+
+  std::string value_of(const std::string &query) const {
+    if (query.starts_with("CMODE")) {
+      return "0C";
+    }
+    return query.starts_with("BRIGHT") ? "128" : "20";
+  }
+};
+
+TEST_F(ColorModeChangeTest, ConfirmedChangeRefreshesPictureSettings) {
+  this->transport_.deliver("PWR=01\r:CMODE=0C\r:BRIGHT=128\r:GAMMA=20\r:");
+  this->answer_all(10);
+  ASSERT_TRUE(this->projector_.is_confirmed(QueryType::BRIGHTNESS));
+
+  this->projector_.set_color_mode("06");
+  std::vector<std::string> sent = this->answer_all(10);
+  std::vector<std::string> expected{"CMODE 06\r", "GAMMA?\r", "BRIGHT?\r"};
+  EXPECT_EQ(sent, expected);
+}
+
+TEST_F(ColorModeChangeTest, ChangedModeIsNoLongerTrusted) {
+  this->transport_.deliver("PWR=01\r:CMODE=0C\r:BRIGHT=128\r:GAMMA=20\r:");
+  this->answer_all(10);
+  this->transport_.deliver("CMODE=06\r:");
+  this->projector_.loop();
+  EXPECT_FALSE(this->projector_.is_confirmed(QueryType::BRIGHTNESS));
+  EXPECT_FALSE(this->projector_.is_confirmed(QueryType::GAMMA));
+  EXPECT_TRUE(this->projector_.is_confirmed(QueryType::COLOR_MODE));
+}
+
+TEST_F(ColorModeChangeTest, UnchangedModeKeepsConfirmations) {
+  this->transport_.deliver("PWR=01\r:CMODE=0C\r:BRIGHT=128\r:");
+  this->answer_all(10);
+  this->transport_.deliver("CMODE=0C\r:");
+  this->projector_.loop();
+  EXPECT_TRUE(this->projector_.is_confirmed(QueryType::BRIGHTNESS));
+}
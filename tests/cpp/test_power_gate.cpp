@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "hub_test.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace esphome::epson_projector;
+
+class PowerGateTest : public HubTest {
+ protected:
+  void SetUp() override {
+    HubTest::SetUp();
+    this->start_in_standby();
+  }
+};
+
+TEST_F(PowerGateTest, SettingsWaitForWarmupAndCoalesce) {
+  this->projector_.set_power(true, true);
+  EXPECT_EQ(this->step(), std::vector<std::string>{"PWR ON\r"});
+  this->step(":PWR=02\r:");
+
+  this->projector_.set_volume(5, true);
+  this->projector_.set_volume(7, true);
+  this->projector_.set_mute(true, true);
+  for (int i = 0; i < 5; i++) {
+    for (const auto &sent : this->step()) {
+      EXPECT_EQ(sent.find(' '), std::string::npos) << "Sent " << sent << " while warming up";
+    }
+  }
+
+  this->transport_.deliver("PWR=01\r:");
+  std::vector<std::string> writes;
+  for (int i = 0; i < 10; i++) {
+    for (const auto &sent : this->step(":")) {
+      if (sent.find(' ') != std::string::npos) {
+        writes.push_back(sent);
+      }
+    }
+  }
+  EXPECT_EQ(writes, (std::vector<std::string>{"VOL 89\r", "MUTE ON\r"}));
+}
+
+TEST_F(PowerGateTest, PowerOffCancelsHeldSettings) {
+  this->projector_.set_power(true, true);
+  this->step();
+  this->step(":PWR=02\r:");
+  this->projector_.set_volume(5, true);
+  this->step();
+
+  this->projector_.set_power(false, true);
+  std::vector<std::string> sent;
+  for (int i = 0; i < 5; i++) {
+    for (const auto &cmd : this->step(":")) {
+      sent.push_back(cmd);
+    }
+  }
+  EXPECT_EQ(std::count(sent.begin(), sent.end(), "PWR OFF\r"), 1);
+  EXPECT_EQ(std::count_if(sent.begin(), sent.end(), [](const std::string &cmd) { return cmd.rfind("VOL ", 0) == 0; }),
+            0);
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include "power_transition.h"
+
+using namespace esphome::epson_projector;
+
+TEST(PowerTransitionTest, UnchangedStateIsNoTransition) {
+  EXPECT_EQ(classify_power_transition(PowerState::ON, PowerState::ON), PowerTransition::NONE);
+  EXPECT_EQ(classify_power_transition(PowerState::WARMUP, PowerState::WARMUP), PowerTransition::NONE);
+  EXPECT_EQ(classify_power_transition(PowerState::STANDBY, PowerState::STANDBY), PowerTransition::NONE);
+}
+
+TEST(PowerTransitionTest, PowerOnSequence) {
+  EXPECT_EQ(classify_power_transition(PowerState::STANDBY, PowerState::WARMUP), PowerTransition::WARMING_UP);
+  EXPECT_EQ(classify_power_transition(PowerState::WARMUP, PowerState::ON), PowerTransition::POWERED_ON);
+}
+
+TEST(PowerTransitionTest, PowerOffSequence) {
+  EXPECT_EQ(classify_power_transition(PowerState::ON, PowerState::COOLDOWN), PowerTransition::COOLING_DOWN);
+  EXPECT_EQ(classify_power_transition(PowerState::COOLDOWN, PowerState::STANDBY), PowerTransition::POWERED_OFF);
+}
+
+TEST(PowerTransitionTest, MissedIntermediateStates) {
+  EXPECT_EQ(classify_power_transition(PowerState::STANDBY, PowerState::ON), PowerTransition::POWERED_ON);
+  EXPECT_EQ(classify_power_transition(PowerState::ON, PowerState::STANDBY), PowerTransition::POWERED_OFF);
+}
+
+TEST(PowerTransitionTest, FirstReportAfterBoot) {
+  EXPECT_EQ(classify_power_transition(PowerState::UNKNOWN, PowerState::ON), PowerTransition::POWERED_ON);
+  EXPECT_EQ(classify_power_transition(PowerState::UNKNOWN, PowerState::STANDBY), PowerTransition::POWERED_OFF);
+  EXPECT_EQ(classify_power_transition(PowerState::ON, PowerState::UNKNOWN), PowerTransition::NONE);
+}
+
+TEST(PowerTransitionTest, TransitionalStates) {
+  EXPECT_TRUE(is_transitional(PowerState::WARMUP));
+  EXPECT_TRUE(is_transitional(PowerState::COOLDOWN));
+  EXPECT_FALSE(is_transitional(PowerState::ON));
+  EXPECT_FALSE(is_transitional(PowerState::STANDBY));
+  EXPECT_FALSE(is_transitional(PowerState::UNKNOWN));
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "session_replay.h"
+
+#include <array>
+#include <memory>
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+// Each byte read takes a millisecond, so a link with data pending uses up the loop budget.
+class SlowTransport : public ReplayTransport {
+ public:
+  bool read_byte(uint8_t *data) override {
+    esphome::MockClock::now++;
+    return ReplayTransport::read_byte(data);
+  }
+};
+
+class ProjectorSchedulerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    esphome::MockClock::enabled = true;
+    esphome::MockClock::now = 0;
+    for (size_t i = 0; i < this->projectors_.size(); i++) {
+      this->projectors_[i] = std::make_unique<EpsonProjector>();
+      this->projectors_[i]->set_transport(&this->transports_[i]);
+      this->projectors_[i]->set_restore_state(false);
+      this->projectors_[i]->setup();
+    }
+  }
+  void TearDown() override { esphome::MockClock::enabled = false; }
+
+  std::array<SlowTransport, 3> transports_;
+  std::array<std::unique_ptr<EpsonProjector>, 3> projectors_;
+};
+
+}  // namespace
+
+TEST_F(ProjectorSchedulerTest, FirstProjectorDrivesAllLinks) {
+  for (auto &transport : this->transports_) {
+    transport.deliver("PWR=01\r:");
+  }
+
+  this->projectors_[1]->loop();
+  this->projectors_[2]->loop();
+  EXPECT_EQ(this->projectors_[1]->power_state(), PowerState::UNKNOWN);
+
+  this->projectors_[0]->set_loop_budget(0);
+  this->projectors_[0]->loop();
+  for (const auto &projector : this->projectors_) {
+    EXPECT_EQ(projector->power_state(), PowerState::ON);
+  }
+}
+
+TEST_F(ProjectorSchedulerTest, LinksLeftOverStartTheNextPass) {
+  this->projectors_[0]->set_loop_budget(2000);
+  for (auto &transport : this->transports_) {
+    transport.deliver("PWR=01\r:");
+  }
+
+  this->projectors_[0]->loop();
+  EXPECT_GT(this->transports_[0].available(), 0);
+  EXPECT_EQ(this->transports_[1].available(), 8);
+
+  this->projectors_[0]->loop();
+  EXPECT_LT(this->transports_[1].available(), 8);
+  EXPECT_EQ(this->transports_[2].available(), 8);
+
+  this->projectors_[0]->loop();
+  EXPECT_LT(this->transports_[2].available(), 8);
+}
+
+TEST_F(ProjectorSchedulerTest, NextProjectorTakesOverWhenDriverGoes) {
+  this->projectors_[0].reset();
+  this->transports_[2].deliver("PWR=00\r:");
+
+  this->projectors_[1]->set_loop_budget(0);
+  this->projectors_[1]->loop();
+  EXPECT_EQ(this->projectors_[2]->power_state(), PowerState::STANDBY);
+}
+
+TEST(ProjectorModelTest, InstanceMaskHidesQueries) {
+  EpsonProjector projector;
+  projector.set_model("Epson EB-U42", query_bit(QueryType::GAMMA));
+  projector.register_query(QueryType::GAMMA);
+  projector.register_query(QueryType::LAMP_HOURS);
+
+  EXPECT_FALSE(projector.supports(QueryType::GAMMA));
+  EXPECT_FALSE(projector.has_query(QueryType::GAMMA));
+  EXPECT_TRUE(projector.has_query(QueryType::LAMP_HOURS));
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "projector_state.h"
+#include "session_replay.h"
+
+using namespace esphome::epson_projector;
+
+static_assert(sizeof(FixedString<STATE_CODE_LENGTH>) == STATE_CODE_LENGTH + 1);
+static_assert(sizeof(ProjectorState) == 60, "No padding beyond the 4-byte tail alignment");
+static_assert(sizeof(PersistedState) <= 64);
+
+TEST(FixedStringTest, AssignsAndCompares) {
+  FixedString<4> code;
+  EXPECT_TRUE(code.empty());
+  code = "A0";
+  EXPECT_EQ(code.view(), "A0");
+  EXPECT_EQ(code.size(), 2u);
+  EXPECT_TRUE(code == "A0");
+  EXPECT_FALSE(code == "A00");
+}
+
+TEST(FixedStringTest, TruncatesToCapacity) {
+  FixedString<4> code;
+  code = "ABCDEFGH";
+  EXPECT_EQ(code.view(), "ABCD");
+  EXPECT_STREQ(code.c_str(), "ABCD");
+}
+
+TEST(FixedStringTest, ShorterValueClearsTail) {
+  FixedString<4> code;
+  code = "1234";
+  code = "5";
+  EXPECT_EQ(code.view(), "5");
+  EXPECT_EQ(code.size(), 1u);
+}
+
+TEST(ProjectorStateTest, FlagsAreIndependent) {
+  ProjectorState state;
+  state.set_flag(STATE_FLAG_MUTED, true);
+  state.set_flag(STATE_FLAG_FROZEN, true);
+  state.set_flag(STATE_FLAG_MUTED, false);
+  EXPECT_FALSE(state.has_flag(STATE_FLAG_MUTED));
+  EXPECT_FALSE(state.has_flag(STATE_FLAG_H_REVERSE));
+  EXPECT_TRUE(state.has_flag(STATE_FLAG_FROZEN));
+}
+
+class ProjectorStateResponseTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    this->projector_.set_transport(&this->transport_);
+    this->projector_.set_restore_state(false);
+    this->projector_.setup();
+  }
+
+  ReplayTransport transport_;
+  EpsonProjector projector_;
+};
+
+TEST_F(ProjectorStateResponseTest, ResponsesLandInPackedState) {
+  this->transport_.deliver("MUTE=ON\r:SOURCE=A0\r:BRIGHT=255\r:HREVERSE=ON\r:SNO=X4KH8300123\r:");
+  this->projector_.loop();
+
+  EXPECT_TRUE(this->projector_.is_muted());
+  EXPECT_TRUE(this->projector_.h_reverse());
+  EXPECT_FALSE(this->projector_.v_reverse());
+  EXPECT_EQ(this->projector_.current_source(), "A0");
+  EXPECT_EQ(this->projector_.brightness(), 100);
+  EXPECT_EQ(this->projector_.serial_number(), "X4KH8300123");
+}
+
+TEST_F(ProjectorStateResponseTest, LongSerialIsTruncated) {
+  this->transport_.deliver("SNO=0123456789ABCDEFXYZ\r:");
+  this->projector_.loop();
+  EXPECT_EQ(this->projector_.serial_number(), "0123456789ABCDEF");
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "query_support.h"
+
+using namespace esphome::epson_projector;
+
+class QuerySupportTest : public ::testing::Test {
+ protected:
+  QuerySupport support;
+};
+
+TEST_F(QuerySupportTest, RetiresAfterThresholdErrors) {
+  EXPECT_FALSE(support.record_error(QueryType::GAMMA));
+  EXPECT_FALSE(support.record_error(QueryType::GAMMA));
+  EXPECT_FALSE(support.is_retired(QueryType::GAMMA));
+
+  EXPECT_TRUE(support.record_error(QueryType::GAMMA));
+  EXPECT_TRUE(support.is_retired(QueryType::GAMMA));
+  EXPECT_FALSE(support.is_retired(QueryType::LUMINANCE));
+}
+
+TEST_F(QuerySupportTest, RetirementIsReportedOnce) {
+  support.set_error_threshold(1);
+  EXPECT_TRUE(support.record_error(QueryType::H_KEYSTONE));
+  EXPECT_FALSE(support.record_error(QueryType::H_KEYSTONE));
+}
+
+TEST_F(QuerySupportTest, SuccessResetsCount) {
+  support.record_error(QueryType::LUMINANCE);
+  support.record_error(QueryType::LUMINANCE);
+  support.record_success(QueryType::LUMINANCE);
+  EXPECT_EQ(support.consecutive_errors(QueryType::LUMINANCE), 0);
+
+  EXPECT_FALSE(support.record_error(QueryType::LUMINANCE));
+  EXPECT_FALSE(support.is_retired(QueryType::LUMINANCE));
+}
+
+TEST_F(QuerySupportTest, SuccessReinstatesRetiredQuery) {
+  support.set_error_threshold(1);
+  support.record_error(QueryType::GAMMA);
+  support.record_success(QueryType::GAMMA);
+  EXPECT_FALSE(support.is_retired(QueryType::GAMMA));
+}
+
+TEST_F(QuerySupportTest, PowerIsNeverRetired) {
+  support.set_error_threshold(1);
+  EXPECT_FALSE(support.record_error(QueryType::POWER));
+  EXPECT_FALSE(support.is_retired(QueryType::POWER));
+}
+
+TEST_F(QuerySupportTest, ResetClearsEverything) {
+  support.set_error_threshold(1);
+  support.record_error(QueryType::GAMMA);
+  support.record_error(QueryType::LUMINANCE);
+  EXPECT_NE(support.retired_mask(), 0u);
+
+  support.reset();
+  EXPECT_EQ(support.retired_mask(), 0u);
+  EXPECT_EQ(support.consecutive_errors(QueryType::GAMMA), 0);
+}
+
+TEST_F(QuerySupportTest, ZeroThresholdClampsToOne) {
+  support.set_error_threshold(0);
+  EXPECT_EQ(support.error_threshold(), 1);
+  EXPECT_TRUE(support.record_error(QueryType::TINT));
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "hub_test.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace esphome::epson_projector;
+
+class RedundantWriteTest : public HubTest {
+ protected:
+  void configure() override { this->projector_.set_update_interval(30000); }
+
+  void SetUp() override {
+    HubTest::SetUp();
+    this->start_in_standby();
+  }
+
+  std::vector<std::string> run(int steps) {
+    std::vector<std::string> sent;
+    for (int i = 0; i < steps; i++) {
+      for (const auto &cmd : this->step(":")) {
+        sent.push_back(cmd);
+      }
+    }
+    return sent;
+  }
+};
+
+TEST_F(RedundantWriteTest, RecentlyConfirmedValueIsNotSent) {
+  this->projector_.set_power(false);
+  EXPECT_TRUE(this->step().empty());
+}
+
+TEST_F(RedundantWriteTest, ConfirmationLastsUntilTheNextPoll) {
+  esphome::MockClock::now += 30000;
+  this->projector_.set_power(false);
+  auto sent = this->step();
+  EXPECT_EQ(std::count(sent.begin(), sent.end(), "PWR OFF\r"), 0);
+}
+
+TEST_F(RedundantWriteTest, StaleConfirmationIsSentAgain) {
+  esphome::MockClock::now += 34000;
+  this->projector_.set_power(false);
+  auto sent = this->run(3);
+  EXPECT_EQ(std::count(sent.begin(), sent.end(), "PWR OFF\r"), 1);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "session_replay.h"
+
+#include <sstream>
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+SessionCapture parse_text(const std::string &text) {
+  std::istringstream input(text);
+  auto capture = parse_capture(input);
+  EXPECT_TRUE(capture.has_value()) << (capture ? "" : capture.error());
+  return capture ? *capture : SessionCapture{};
+}
+
+SessionCapture load_fixture(const std::string &name) {
+  auto capture = load_capture(std::string(CAPTURE_DIR) + "/" + name);
+  EXPECT_TRUE(capture.has_value()) << (capture ? "" : capture.error());
+  return capture ? *capture : SessionCapture{};
+}
+
+}  // namespace
+
+TEST(SessionCaptureTest, ParsesDirectivesAndFrames) {
+  auto capture = parse_text(
+      "# comment\n"
+      "@update_interval 2000\n"
+      "@query PWR SNO\n"
+      "10 TX PWR ON\\r\n"
+      "55 RX :\n");
+
+  EXPECT_EQ(capture.update_interval, 2000u);
+  ASSERT_EQ(capture.queries.size(), 2u);
+  EXPECT_EQ(capture.queries[1], QueryType::SERIAL_NUMBER);
+  ASSERT_EQ(capture.events.size(), 2u);
+  EXPECT_EQ(capture.events[0].direction, TraceDirection::TX);
+  EXPECT_EQ(capture.events[0].bytes, "PWR ON\r");
+  EXPECT_EQ(capture.events[1].timestamp, 55u);
+  EXPECT_EQ(capture.events[1].bytes, ":");
+}
+
+TEST(SessionCaptureTest, RejectsMalformedLines) {
+  for (const char *text : {"@query NOPE\n", "10 XX PWR?\\r\n", "20 RX :\n10 RX :\n", "abc TX PWR?\\r\n"}) {
+    std::istringstream input(text);
+    EXPECT_FALSE(parse_capture(input).has_value()) << text;
+  }
+}
+
+TEST(SessionReplayTest, StrayPromptAndSlowSerialNumber) {
+  SessionReplay replay(load_fixture("power_on_prompt.cap"), 1);
+  auto report = replay.run();
+
+  EXPECT_TRUE(report.tx_mismatches.empty());
+  EXPECT_EQ(report.tx_sent, report.tx_expected);
+  EXPECT_EQ(report.rx_delivered, 4u);
+  for (const auto &frame : report.frames) {
+    EXPECT_TRUE(frame.parsed) << escape_wire_bytes(frame.bytes);
+  }
+  EXPECT_EQ(replay.projector().power_state(), PowerState::ON);
+  EXPECT_EQ(replay.projector().lamp_hours(), 1200u);
+  EXPECT_EQ(replay.projector().serial_number(), "X4KH8300123");
+  EXPECT_EQ(replay.projector().link_state(), LinkState::UP);
+}
+
+TEST(SessionReplayTest, RejectedQueryStopsBeingPolled) {
+  SessionReplay replay(load_fixture("gamma_rejected.cap"), 1);
+  auto report = replay.run();
+
+  EXPECT_TRUE(report.tx_mismatches.empty());
+  EXPECT_EQ(report.tx_sent, 8u);
+  EXPECT_TRUE(replay.projector().is_confirmed(QueryType::POWER));
+  EXPECT_FALSE(replay.projector().is_confirmed(QueryType::GAMMA));
+}
+
+TEST(SessionReplayTest, ReportsUnexpectedCommand) {
+  SessionReplay replay(parse_text(
+                           "@query PWR\n"
+                           "51 TX LAMP?\\r\n"
+                           "90 RX LAMP=10\\r:\n"),
+                       1);
+  auto report = replay.run();
+
+  ASSERT_EQ(report.tx_mismatches.size(), 1u);
+  EXPECT_EQ(report.tx_mismatches[0].expected, "LAMP?\r");
+  EXPECT_EQ(report.tx_mismatches[0].actual, "PWR?\r");
+}
+
+TEST(SessionReplayTest, NoiseOverflowResyncsAndResends) {
+  SessionReplay replay(load_fixture("rx_noise_resync.cap"), 1);
+  auto report = replay.run();
+
+  EXPECT_TRUE(report.tx_mismatches.empty());
+  EXPECT_EQ(report.tx_sent, 2u);
+  EXPECT_LT(report.duration_ms, 1000u);
+  EXPECT_EQ(replay.projector().power_state(), PowerState::ON);
+  EXPECT_EQ(replay.projector().link_state(), LinkState::UP);
+}
@@ -105,7 +105,7 @@ TEST_F(ResponseParserTest, ParsesVolumeScaling) {
   ASSERT_TRUE(result.has_value());
   auto *vol = std::get_if<VolumeResponse>(&*result);
   ASSERT_NE(vol, nullptr);
-  EXPECT_EQ(vol->value, 14);
+  EXPECT_EQ(vol->value, 15);
 }
 
 TEST_F(ResponseParserTest, ParsesVolumeScalingMax) {
@@ -140,7 +140,7 @@ TEST_F(ResponseParserTest, ParsesSharpnessScaling) {
   ASSERT_TRUE(result.has_value());
   auto *sharp = std::get_if<SharpnessResponse>(&*result);
   ASSERT_NE(sharp, nullptr);
-  EXPECT_EQ(sharp->value, 9);
+  EXPECT_EQ(sharp->value, 10);
 }
 
 TEST_F(ResponseParserTest, ParsesSharpnessScalingMax) {
@@ -156,7 +156,7 @@ TEST_F(ResponseParserTest, ParsesDensityScaling) {
   ASSERT_TRUE(result.has_value());
   auto *density = std::get_if<DensityResponse>(&*result);
   ASSERT_NE(density, nullptr);
-  EXPECT_EQ(density->value, 49);
+  EXPECT_EQ(density->value, 50);
 }
 
 TEST_F(ResponseParserTest, ParsesDensityScalingMax) {
@@ -172,7 +172,7 @@ TEST_F(ResponseParserTest, ParsesTintScaling) {
   ASSERT_TRUE(result.has_value());
   auto *tint = std::get_if<TintResponse>(&*result);
   ASSERT_NE(tint, nullptr);
-  EXPECT_EQ(tint->value, 49);
+  EXPECT_EQ(tint->value, 50);
 }
 
 TEST_F(ResponseParserTest, ParsesTintScalingMax) {
@@ -188,7 +188,7 @@ TEST_F(ResponseParserTest, ParsesColorTemperatureScaling) {
   ASSERT_TRUE(result.has_value());
   auto *ctemp = std::get_if<ColorTempResponse>(&*result);
   ASSERT_NE(ctemp, nullptr);
-  EXPECT_EQ(ctemp->value, 4);
+  EXPECT_EQ(ctemp->value, 5);
 }
 
 TEST_F(ResponseParserTest, ParsesColorTemperatureScalingMax) {
@@ -204,7 +204,7 @@ TEST_F(ResponseParserTest, ParsesVKeystoneScaling) {
   ASSERT_TRUE(result.has_value());
   auto *vk = std::get_if<VKeystoneResponse>(&*result);
   ASSERT_NE(vk, nullptr);
-  EXPECT_EQ(vk->value, 29);
+  EXPECT_EQ(vk->value, 30);
 }
 
 TEST_F(ResponseParserTest, ParsesVKeystoneScalingMax) {
@@ -220,7 +220,7 @@ TEST_F(ResponseParserTest, ParsesHKeystoneScaling) {
   ASSERT_TRUE(result.has_value());
   auto *hk = std::get_if<HKeystoneResponse>(&*result);
   ASSERT_NE(hk, nullptr);
-  EXPECT_EQ(hk->value, 29);
+  EXPECT_EQ(hk->value, 30);
 }
 
 TEST_F(ResponseParserTest, ParsesHReverseOn) {
@@ -382,7 +382,7 @@ TEST_F(ResponseParserTest, ParsesBrightnessScalingMid) {
   ASSERT_TRUE(result.has_value());
   auto *bright = std::get_if<BrightnessResponse>(&*result);
   ASSERT_NE(bright, nullptr);
-  EXPECT_EQ(bright->value, 49);
+  EXPECT_EQ(bright->value, 50);
 }
 
 TEST_F(ResponseParserTest, ParsesContrastScalingMax) {
@@ -455,4 +455,12 @@ TEST_F(ResponseParserTest, ParsesEmptyResponse) {
   EXPECT_TRUE(result.error().contains("Empty response"));
 }
 
+TEST_F(ResponseParserTest, DetectsErrorResponse) {
+  EXPECT_TRUE(parser.is_error_response("ERR\r:"));
+  EXPECT_TRUE(parser.is_error_response("ERR"));
+  EXPECT_FALSE(parser.is_error_response("ERR=00\r:"));
+  EXPECT_FALSE(parser.is_error_response(":"));
+  EXPECT_FALSE(parser.is_error_response("PWR=01\r:"));
+}
+
 }  // namespace esphome::epson_projector
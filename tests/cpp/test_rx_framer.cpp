@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include "rx_framer.h"
+
+#include <string_view>
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+FrameStatus push_all(RxFramer &framer, std::string_view bytes) {
+  FrameStatus status = FrameStatus::NONE;
+  for (char c : bytes) {
+    status = framer.push(static_cast<uint8_t>(c));
+  }
+  return status;
+}
+
+}  // namespace
+
+TEST(RxFramerTest, CompletesFrameAtPrompt) {
+  RxFramer framer;
+  EXPECT_EQ(push_all(framer, "PWR=01\r"), FrameStatus::NONE);
+  EXPECT_EQ(framer.push(':'), FrameStatus::FRAME);
+  EXPECT_EQ(framer.frame(), "PWR=01\r:");
+}
+
+TEST(RxFramerTest, StartsNewFrameAfterCompletion) {
+  RxFramer framer;
+  push_all(framer, "PWR=01\r:");
+  EXPECT_EQ(push_all(framer, "LAMP=10\r:"), FrameStatus::FRAME);
+  EXPECT_EQ(framer.frame(), "LAMP=10\r:");
+}
+
+TEST(RxFramerTest, ReportsBarePrompt) {
+  RxFramer framer;
+  EXPECT_EQ(framer.push(':'), FrameStatus::PROMPT);
+  EXPECT_EQ(push_all(framer, "\r:"), FrameStatus::PROMPT);
+}
+
+TEST(RxFramerTest, DropsNulAndFramingErrorBytes) {
+  RxFramer framer;
+  EXPECT_EQ(push_all(framer, std::string_view("P\0WR\xFF=01\r:", 10)), FrameStatus::FRAME);
+  EXPECT_EQ(framer.frame(), "PWR=01\r:");
+  EXPECT_EQ(framer.dropped_bytes(), 2u);
+}
+
+TEST(RxFramerTest, DiscardsToNextCarriageReturnOnOverflow) {
+  RxFramer framer;
+  for (size_t i = 0; i < RxFramer::CAPACITY + 10; i++) {
+    EXPECT_EQ(framer.push('x'), FrameStatus::NONE);
+  }
+  EXPECT_EQ(framer.overflows(), 1u);
+  EXPECT_TRUE(framer.is_discarding());
+  EXPECT_LE(framer.frame().capacity(), RxFramer::CAPACITY);
+
+  EXPECT_EQ(framer.push('\r'), FrameStatus::RESYNC);
+  EXPECT_EQ(framer.resyncs(), 1u);
+  EXPECT_EQ(framer.push(':'), FrameStatus::PROMPT);
+  EXPECT_EQ(push_all(framer, "PWR=01\r:"), FrameStatus::FRAME);
+  EXPECT_EQ(framer.frame(), "PWR=01\r:");
+}
+
+TEST(RxFramerTest, AcceptsFrameThatFillsBuffer) {
+  RxFramer framer;
+  std::string frame(RxFramer::CAPACITY - 1, 'a');
+  EXPECT_EQ(push_all(framer, frame + ":"), FrameStatus::FRAME);
+  EXPECT_EQ(framer.overflows(), 0u);
+}
+
+TEST(RxFramerTest, ClearLeavesDiscardMode) {
+  RxFramer framer;
+  push_all(framer, std::string(RxFramer::CAPACITY, 'x'));
+  ASSERT_TRUE(framer.is_discarding());
+  framer.clear();
+  EXPECT_FALSE(framer.is_discarding());
+  EXPECT_EQ(push_all(framer, "ERR\r:"), FrameStatus::FRAME);
+}
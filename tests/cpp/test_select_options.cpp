@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include "select_options.h"
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+constexpr SelectOption SOURCES[] = {
+    {"HDMI1", "30"}, {"HDMI2", "A0"}, {"Computer1", "10"}, {"Video", "41"}, {"USB", "52"},
+};
+constexpr uint8_t SOURCES_BY_CODE[] = {2, 0, 3, 4, 1};
+constexpr SelectOptionTable TABLE{SOURCES, SOURCES_BY_CODE, std::size(SOURCES)};
+
+}  // namespace
+
+TEST(SelectOptionsTest, KeepsDisplayOrder) {
+  ASSERT_EQ(TABLE.size(), 5u);
+  EXPECT_STREQ(TABLE[0].name, "HDMI1");
+  EXPECT_STREQ(TABLE[2].name, "Computer1");
+}
+
+TEST(SelectOptionsTest, IndexOfName) {
+  EXPECT_EQ(TABLE.index_of_name("HDMI1"), 0u);
+  EXPECT_EQ(TABLE.index_of_name("USB"), 4u);
+  EXPECT_FALSE(TABLE.index_of_name("LAN").has_value());
+  EXPECT_FALSE(TABLE.index_of_name("hdmi1").has_value());
+}
+
+TEST(SelectOptionsTest, IndexOfCodeFindsEveryOption) {
+  for (size_t i = 0; i < TABLE.size(); i++) {
+    EXPECT_EQ(TABLE.index_of_code(TABLE[i].code), i) << TABLE[i].code;
+  }
+}
+
+TEST(SelectOptionsTest, IndexOfCodeRejectsUnknownCodes) {
+  EXPECT_FALSE(TABLE.index_of_code("").has_value());
+  EXPECT_FALSE(TABLE.index_of_code("00").has_value());
+  EXPECT_FALSE(TABLE.index_of_code("35").has_value());
+  EXPECT_FALSE(TABLE.index_of_code("FF").has_value());
+  EXPECT_FALSE(TABLE.index_of_code("3").has_value());
+}
+
+TEST(SelectOptionsTest, LookupsAreConstexpr) {
+  static_assert(TABLE.index_of_code("A0") == 1u);
+  static_assert(TABLE.index_of_name("Video") == 3u);
+  static_assert(!TABLE.index_of_code("99").has_value());
+}
+
+TEST(SelectOptionsTest, EmptyTable) {
+  constexpr SelectOptionTable empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_FALSE(empty.index_of_code("30").has_value());
+  EXPECT_FALSE(empty.index_of_name("HDMI1").has_value());
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "hub_test.h"
+#include "sequence.h"
+
+#include <string>
+#include <vector>
+
+using namespace esphome::epson_projector;
+
+namespace {
+
+Sequence power_on_to_hdmi(EpsonProjector &projector, std::vector<std::string> &log) {
+  log.push_back(co_await projector.set_power(true) ? "power" : "power failed");
+  log.push_back(co_await projector.until(PowerState::ON) ? "on" : "on timed out");
+  log.push_back(co_await projector.set_source("30") ? "source" : "source failed");
+  log.push_back(co_await projector.query(QueryType::SOURCE) ? "queried" : "query failed");
+}
+
+Sequence set_volume_once(EpsonProjector &projector, bool &result) {
+  result = co_await projector.set_volume(5, true);
+}
+
+Sequence wait_for_on(EpsonProjector &projector, bool &result) {
+  result = co_await projector.until(PowerState::ON, 5000);
+}
+
+Sequence idle() { co_return; }
+
+}  // namespace
+
+class SequenceTest : public HubTest {
+ protected:
+  void SetUp() override {
+    HubTest::SetUp();
+    this->start_in_standby();
+  }
+
+  // A second pass lets a resumed sequence queue its next command within the same step.
+  void run_loop() override {
+    this->projector_.loop();
+    this->projector_.loop();
+  }
+};
+
+TEST_F(SequenceTest, StepsFollowProjectorReplies) {
+  std::vector<std::string> log;
+  ASSERT_TRUE(this->projector_.run(power_on_to_hdmi(this->projector_, log)));
+
+  EXPECT_EQ(this->step(), std::vector<std::string>{"PWR ON\r"});
+  this->step(":");
+  EXPECT_EQ(log, std::vector<std::string>{"power"});
+
+  for (int i = 0; i < 5; i++) {
+    for (const auto &sent : this->step()) {
+      EXPECT_EQ(sent, "PWR?\r");
+      this->transport_.deliver("PWR=02\r:");
+    }
+  }
+  EXPECT_EQ(log.size(), 1u);
+
+  this->transport_.deliver("PWR=01\r:");
+  EXPECT_EQ(this->step(), std::vector<std::string>{"SOURCE 30\r"});
+  EXPECT_EQ(log, (std::vector<std::string>{"power", "on"}));
+  EXPECT_EQ(this->step(":"), std::vector<std::string>{"SOURCE?\r"});
+  this->step("SOURCE=30\r:");
+  EXPECT_EQ(log, (std::vector<std::string>{"power", "on", "source", "queried"}));
+  EXPECT_EQ(this->projector_.current_source(), "30");
+  EXPECT_EQ(SequenceFramePool::in_use(), 0u);
+}
+
+TEST_F(SequenceTest, RejectedWriteYieldsFalse) {
+  this->transport_.deliver("PWR=01\r:");
+  this->projector_.loop();
+  bool result = true;
+  ASSERT_TRUE(this->projector_.run(set_volume_once(this->projector_, result)));
+  EXPECT_EQ(this->step(), std::vector<std::string>{"VOL 64\r"});
+  for (int i = 0; i < 5; i++) {
+    this->step("ERR\r:");
+  }
+  EXPECT_FALSE(result);
+  EXPECT_EQ(SequenceFramePool::in_use(), 0u);
+}
+
+TEST_F(SequenceTest, UntilTimesOut) {
+  bool result = true;
+  ASSERT_TRUE(this->projector_.run(wait_for_on(this->projector_, result)));
+  this->step();
+  EXPECT_TRUE(result);
+  for (int i = 0; i < 6; i++) {
+    this->step();
+  }
+  EXPECT_FALSE(result);
+}
+
+TEST_F(SequenceTest, FramesComeFromFixedPool) {
+  std::vector<Sequence> held;
+  for (size_t i = 0; i < SEQUENCE_POOL_SIZE; i++) {
+    held.push_back(idle());
+    EXPECT_TRUE(held.back().valid());
+  }
+  EXPECT_EQ(SequenceFramePool::in_use(), SEQUENCE_POOL_SIZE);
+  Sequence overflow = idle();
+  EXPECT_FALSE(overflow.valid());
+  EXPECT_FALSE(this->projector_.run(std::move(overflow)));
+
+  held.clear();
+  EXPECT_EQ(SequenceFramePool::in_use(), 0u);
+}
+
+TEST_F(SequenceTest, RunRefusesWhenAllSlotsBusy) {
+  bool a = false;
+  bool b = false;
+  bool c = false;
+  EXPECT_TRUE(this->projector_.run(wait_for_on(this->projector_, a)));
+  EXPECT_TRUE(this->projector_.run(wait_for_on(this->projector_, b)));
+  EXPECT_FALSE(this->projector_.run(wait_for_on(this->projector_, c)));
+  EXPECT_EQ(SequenceFramePool::in_use(), 2u);
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "hub_test.h"
+#include "json_writer.h"
+
+#include <string>
+
+using namespace esphome::epson_projector;
+
+TEST(JsonWriterTest, WritesNestedObjects) {
+  std::string out;
+  JsonWriter writer(out);
+  writer.begin_object();
+  writer.key("a");
+  writer.number(-12);
+  writer.key("b");
+  writer.begin_object();
+  writer.key("c");
+  writer.boolean(true);
+  writer.key("d");
+  writer.string("x");
+  writer.end_object();
+  writer.key("e");
+  writer.begin_object();
+  writer.end_object();
+  writer.end_object();
+  EXPECT_EQ(out, R"({"a":-12,"b":{"c":true,"d":"x"},"e":{}})");
+}
+
+TEST(JsonWriterTest, EscapesStrings) {
+  std::string out;
+  JsonWriter writer(out);
+  writer.string("a\"b\\c\r\x01");
+  EXPECT_EQ(out, R"("a\"b\\c\u000d\u0001")");
+}
+
+TEST(JsonWriterTest, ReusedBufferKeepsCapacity) {
+  std::string out;
+  for (int i = 0; i < 2; i++) {
+    out.clear();
+    JsonWriter writer(out);
+    writer.begin_object();
+    writer.key("serial");
+    writer.string("X4KH8300123");
+    writer.end_object();
+  }
+  size_t capacity = out.capacity();
+  out.clear();
+  JsonWriter writer(out);
+  writer.begin_object();
+  writer.end_object();
+  EXPECT_EQ(out.capacity(), capacity);
+}
+
+class SnapshotTest : public HubTest {
+ protected:
+  void configure() override { esphome::MockClock::now = 1000; }
+};
+
+TEST_F(SnapshotTest, EmptyStateHasOnlyLinkHealth) {
+  std::string out;
+  this->projector_.write_snapshot(out);
+  EXPECT_EQ(out, R"({"model":"Generic ESC/VP21","now_ms":1000,)"
+                 R"("link":{"state":"UP","timeouts":0,"rx_overflows":0,"max_loop_us":0},"queries":{}})");
+}
+
+TEST_F(SnapshotTest, ReceivedValuesCarryConfirmationTime) {
+  this->transport_.deliver("PWR=01\r:");
+  this->projector_.loop();
+  esphome::MockClock::now = 2500;
+  this->transport_.deliver("SOURCE=30\r:MUTE=ON\r:VOL=89\r:SNO=X4K\"1\r:");
+  this->projector_.loop();
+  esphome::MockClock::now = 4000;
+
+  std::string out;
+  this->projector_.write_snapshot(out);
+  EXPECT_NE(out.find(R"("now_ms":4000)"), std::string::npos) << out;
+  EXPECT_NE(out.find(R"("PWR":{"value":"ON","confirmed_ms":1000})"), std::string::npos) << out;
+  EXPECT_NE(out.find(R"("SOURCE":{"value":"30","confirmed_ms":2500})"), std::string::npos) << out;
+  EXPECT_NE(out.find(R"("MUTE":{"value":true,"confirmed_ms":2500})"), std::string::npos) << out;
+  EXPECT_NE(out.find(R"("VOL":{"value":7,"confirmed_ms":2500})"), std::string::npos) << out;
+  EXPECT_NE(out.find(R"("SNO":{"value":"X4K\"1","confirmed_ms":2500})"), std::string::npos) << out;
+  EXPECT_EQ(out.find("LAMP"), std::string::npos) << out;
+}
+
+TEST_F(SnapshotTest, PendingWriteIsFlagged) {
+  this->transport_.deliver("PWR=01\r:VOL=89\r:");
+  this->projector_.loop();
+  this->projector_.set_volume(10);
+
+  std::string out;
+  this->projector_.write_snapshot(out);
+  EXPECT_NE(out.find(R"("VOL":{"value":7,"confirmed_ms":1000,"pending":true})"), std::string::npos) << out;
+}
@@ -0,0 +1,212 @@
+#include "tcp_transport.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace esphome::epson_projector {
+
+namespace {
+
+class FakeProjectorServer {
+ public:
+  explicit FakeProjectorServer(uint8_t handshake_status = ESCVP_NET_STATUS_OK, uint8_t field_count = 0)
+      : handshake_status_(handshake_status), field_count_(field_count) {
+    listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    int enable = 1;
+    ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    struct sockaddr_in addr {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    ::bind(listen_fd_, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr));
+    ::listen(listen_fd_, 1);
+    socklen_t len = sizeof(addr);
+    ::getsockname(listen_fd_, reinterpret_cast<struct sockaddr *>(&addr), &len);
+    port_ = ntohs(addr.sin_port);
+    thread_ = std::thread([this]() { this->serve(); });
+  }
+
+  ~FakeProjectorServer() {
+    int client_fd = client_fd_.load();
+    if (client_fd >= 0) {
+      ::shutdown(client_fd, SHUT_RDWR);
+    }
+    ::shutdown(listen_fd_, SHUT_RDWR);
+    ::close(listen_fd_);
+    thread_.join();
+  }
+
+  [[nodiscard]] uint16_t port() const { return port_; }
+  [[nodiscard]] bool handshake_valid() const { return handshake_valid_; }
+
+ private:
+  void serve() {
+    int fd = ::accept(listen_fd_, nullptr, nullptr);
+    if (fd < 0) {
+      return;
+    }
+    client_fd_ = fd;
+    uint8_t request[ESCVP_NET_HEADER_SIZE];
+    if (read_exact(fd, request, sizeof(request))) {
+      auto expected = build_escvp_net_connect();
+      handshake_valid_ = std::memcmp(request, expected.data(), expected.size()) == 0;
+      auto reply = expected;
+      reply[14] = handshake_status_;
+      reply[15] = field_count_;
+      ::send(fd, reply.data(), reply.size(), MSG_NOSIGNAL);
+      for (uint8_t i = 0; i < field_count_; ++i) {
+        uint8_t field[ESCVP_NET_FIELD_SIZE]{};
+        ::send(fd, field, sizeof(field), MSG_NOSIGNAL);
+      }
+    }
+    std::string command;
+    char c;
+    while (handshake_status_ == ESCVP_NET_STATUS_OK && ::recv(fd, &c, 1, 0) == 1) {
+      command += c;
+      if (c != '\r') {
+        continue;
+      }
+      std::string response = command == "PWR?\r" ? "PWR=01\r:" : ":";
+      ::send(fd, response.data(), response.size(), MSG_NOSIGNAL);
+      command.clear();
+    }
+    ::close(fd);
+  }
+
+  static bool read_exact(int fd, uint8_t *buf, size_t len) {
+    size_t got = 0;
+    while (got < len) {
+      ssize_t n = ::recv(fd, buf + got, len - got, 0);
+      if (n <= 0) {
+        return false;
+      }
+      got += n;
+    }
+    return true;
+  }
+
+  int listen_fd_;
+  uint16_t port_{0};
+  uint8_t handshake_status_;
+  uint8_t field_count_;
+  std::atomic<int> client_fd_{-1};
+  std::atomic<bool> handshake_valid_{false};
+  std::thread thread_;
+};
+
+template <typename Pred>
+bool run_until(TcpTransport &transport, Pred pred, std::chrono::milliseconds timeout = std::chrono::seconds(2)) {
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (std::chrono::steady_clock::now() < deadline) {
+    transport.loop();
+    if (pred()) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+std::string read_response(TcpTransport &transport) {
+  std::string response;
+  run_until(transport, [&]() {
+    uint8_t byte;
+    while (transport.available() > 0 && transport.read_byte(&byte)) {
+      response += static_cast<char>(byte);
+    }
+    return !response.empty() && response.back() == ':';
+  });
+  return response;
+}
+
+}  // namespace
+
+TEST(TcpTransportTest, StartsDisconnected) {
+  TcpTransport transport;
+  EXPECT_FALSE(transport.is_connected());
+  EXPECT_EQ(transport.available(), 0);
+}
+
+TEST(TcpTransportTest, ConnectsAndExchangesCommands) {
+  FakeProjectorServer server;
+  TcpTransport transport;
+  transport.set_host("127.0.0.1");
+  transport.set_port(server.port());
+
+  ASSERT_TRUE(run_until(transport, [&]() { return transport.is_connected(); }));
+  EXPECT_TRUE(server.handshake_valid());
+
+  transport.write_str("PWR?\r");
+  EXPECT_EQ(read_response(transport), "PWR=01\r:");
+
+  transport.write_str("VOL 10\r");
+  EXPECT_EQ(read_response(transport), ":");
+}
+
+TEST(TcpTransportTest, ResolvesHostName) {
+  FakeProjectorServer server;
+  TcpTransport transport;
+  transport.set_host("localhost");
+  transport.set_port(server.port());
+
+  ASSERT_TRUE(run_until(transport, [&]() { return transport.is_connected(); }));
+  transport.write_str("PWR?\r");
+  EXPECT_EQ(read_response(transport), "PWR=01\r:");
+}
+
+TEST(TcpTransportTest, SkipsHandshakeFields) {
+  FakeProjectorServer server(ESCVP_NET_STATUS_OK, 2);
+  TcpTransport transport;
+  transport.set_host("127.0.0.1");
+  transport.set_port(server.port());
+
+  ASSERT_TRUE(run_until(transport, [&]() { return transport.is_connected(); }));
+  transport.write_str("PWR?\r");
+  EXPECT_EQ(read_response(transport), "PWR=01\r:");
+}
+
+TEST(TcpTransportTest, RejectedHandshakeStaysDisconnected) {
+  FakeProjectorServer server(0x41);
+  TcpTransport transport;
+  transport.set_host("127.0.0.1");
+  transport.set_port(server.port());
+
+  EXPECT_FALSE(run_until(transport, [&]() { return transport.is_connected(); }, std::chrono::milliseconds(300)));
+}
+
+TEST(TcpTransportTest, InvalidHostStaysDisconnected) {
+  TcpTransport transport;
+  transport.set_host("not-an-ip");
+  EXPECT_FALSE(run_until(transport, [&]() { return transport.is_connected(); }, std::chrono::milliseconds(50)));
+}
+
+TEST(TcpTransportTest, ReconnectsAfterServerCloses) {
+  TcpTransport transport;
+  {
+    FakeProjectorServer first;
+    transport.set_host("127.0.0.1");
+    transport.set_port(first.port());
+    ASSERT_TRUE(run_until(transport, [&]() { return transport.is_connected(); }));
+  }
+  ASSERT_TRUE(run_until(transport, [&]() { return transport.available() == 0 && !transport.is_connected(); }));
+
+  FakeProjectorServer second;
+  transport.set_port(second.port());
+  ASSERT_TRUE(run_until(
+      transport, [&]() { return transport.is_connected(); },
+      std::chrono::milliseconds(TcpTransport::RECONNECT_DELAY_MIN_MS + 2000)));
+  transport.write_str("PWR?\r");
+  EXPECT_EQ(read_response(transport), "PWR=01\r:");
+}
+
+TEST(TcpTransportTest, WriteWhileDisconnectedIsDropped) {
+  TcpTransport transport;
+  transport.write_str("PWR?\r");
+  EXPECT_EQ(transport.available(), 0);
+}
+
+}  // namespace esphome::epson_projector
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "esphome/core/hal.h"
+
+#include "session_replay.h"
+#include "value_scale.h"
+
+#include <string>
+
+using namespace esphome::epson_projector;
+
+static_assert(ValueScale<VOLUME_MAX>::to_raw(7) == 89);
+static_assert(ValueScale<VOLUME_MAX>::from_raw(89) == 7);
+static_assert(ValueScale<BRIGHTNESS_MAX>::to_raw(BRIGHTNESS_MAX) == PROJECTOR_RAW_MAX);
+
+namespace {
+
+template <int UiMax>
+void expect_round_trip() {
+  using Scale = ValueScale<UiMax>;
+  EXPECT_EQ(Scale::to_raw(0), 0);
+  EXPECT_EQ(Scale::to_raw(UiMax), PROJECTOR_RAW_MAX);
+  for (int ui = 0; ui <= UiMax; ui++) {
+    EXPECT_EQ(Scale::from_raw(Scale::to_raw(ui)), ui) << "max " << UiMax << ", value " << ui;
+    if (ui > 0) {
+      EXPECT_GT(Scale::to_raw(ui), Scale::to_raw(ui - 1)) << "max " << UiMax << ", value " << ui;
+    }
+  }
+  for (int raw = 0; raw <= PROJECTOR_RAW_MAX; raw++) {
+    int ui = Scale::from_raw(raw);
+    EXPECT_EQ(Scale::from_raw(Scale::to_raw(ui)), ui) << "max " << UiMax << ", raw " << raw;
+    if (raw > 0) {
+      EXPECT_GE(ui, Scale::from_raw(raw - 1)) << "max " << UiMax << ", raw " << raw;
+    }
+  }
+}
+
+template <int UiMax>
+void expect_tables_match_formula() {
+  using Scale = ValueScale<UiMax>;
+  for (int ui = 0; ui <= UiMax; ui++) {
+    EXPECT_EQ(Scale::TO_RAW[ui], Scale::compute_to_raw(ui)) << "max " << UiMax << ", value " << ui;
+  }
+  for (int raw = 0; raw <= PROJECTOR_RAW_MAX; raw++) {
+    EXPECT_EQ(Scale::FROM_RAW[raw], Scale::compute_from_raw(raw)) << "max " << UiMax << ", raw " << raw;
+  }
+}
+
+}  // namespace
+
+TEST(ValueScaleTest, EveryRangeRoundTrips) {
+  expect_round_trip<VOLUME_MAX>();
+  expect_round_trip<BRIGHTNESS_MAX>();
+  expect_round_trip<CONTRAST_MAX>();
+  expect_round_trip<SHARPNESS_MAX>();
+  expect_round_trip<DENSITY_MAX>();
+  expect_round_trip<TINT_MAX>();
+  expect_round_trip<COLOR_TEMP_MAX>();
+  expect_round_trip<KEYSTONE_MAX>();
+}
+
+// ESP8266 builds use the formula instead of the tables.
+TEST(ValueScaleTest, TablesMatchFormula) {
+  expect_tables_match_formula<VOLUME_MAX>();
+  expect_tables_match_formula<BRIGHTNESS_MAX>();
+  expect_tables_match_formula<CONTRAST_MAX>();
+  expect_tables_match_formula<SHARPNESS_MAX>();
+  expect_tables_match_formula<DENSITY_MAX>();
+  expect_tables_match_formula<TINT_MAX>();
+  expect_tables_match_formula<COLOR_TEMP_MAX>();
+  expect_tables_match_formula<KEYSTONE_MAX>();
+}
+
+TEST(ValueScaleTest, ClampsOutOfRangeInput) {
+  EXPECT_EQ(ValueScale<VOLUME_MAX>::to_raw(-3), 0);
+  EXPECT_EQ(ValueScale<VOLUME_MAX>::to_raw(VOLUME_MAX + 5), PROJECTOR_RAW_MAX);
+  EXPECT_EQ(ValueScale<VOLUME_MAX>::from_raw(-1), 0);
+  EXPECT_EQ(ValueScale<VOLUME_MAX>::from_raw(300), VOLUME_MAX);
+}
+
+TEST(ValueScaleTest, WrittenVolumeReadsBackUnchanged) {
+  esphome::MockClock::enabled = true;
+  esphome::MockClock::now = 0;
+  ReplayTransport transport;
+  EpsonProjector projector;
+  projector.set_transport(&transport);
+  projector.set_restore_state(false);
+  projector.setup();
+
+  for (int volume = 0; volume <= VOLUME_MAX; volume++) {
+    esphome::MockClock::now += 1000;
+    projector.set_volume(volume, true);
+    projector.loop();
+    auto sent = transport.take_sent();
+    ASSERT_EQ(sent.size(), 1u);
+    ASSERT_EQ(sent[0].rfind("VOL ", 0), 0u) << sent[0];
+    transport.deliver(":VOL=" + sent[0].substr(4, sent[0].size() - 5) + "\r:");
+    projector.loop();
+    EXPECT_EQ(projector.volume(), volume) << sent[0];
+  }
+  esphome::MockClock::enabled = false;
+}
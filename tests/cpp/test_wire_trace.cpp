@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "wire_trace.h"
+
+using namespace esphome::epson_projector;
+
+TEST(WireTraceTest, StartsEmpty) {
+  WireTrace<4> trace;
+  EXPECT_EQ(trace.size(), 0u);
+  EXPECT_EQ(trace.capacity(), 4u);
+}
+
+TEST(WireTraceTest, RecordsFramesOldestFirst) {
+  WireTrace<4> trace;
+  trace.record(TraceDirection::TX, 100, find_query_info(QueryType::POWER), "PWR?\r");
+  trace.record(TraceDirection::RX, 150, find_query_info(QueryType::POWER), "PWR=01\r:");
+
+  ASSERT_EQ(trace.size(), 2u);
+  EXPECT_EQ(trace.at(0).direction, TraceDirection::TX);
+  EXPECT_EQ(trace.at(0).timestamp, 100u);
+  EXPECT_EQ(trace.at(0).bytes(), "PWR?\r");
+  EXPECT_EQ(trace.at(1).direction, TraceDirection::RX);
+  EXPECT_EQ(trace.at(1).bytes(), "PWR=01\r:");
+}
+
+TEST(WireTraceTest, OverwritesOldestWhenFull) {
+  WireTrace<3> trace;
+  for (uint32_t i = 0; i < 5; i++) {
+    trace.record(TraceDirection::TX, i, nullptr, std::to_string(i));
+  }
+  ASSERT_EQ(trace.size(), 3u);
+  EXPECT_EQ(trace.at(0).bytes(), "2");
+  EXPECT_EQ(trace.at(1).bytes(), "3");
+  EXPECT_EQ(trace.at(2).bytes(), "4");
+}
+
+TEST(WireTraceTest, TruncatesLongFrames) {
+  WireTrace<2> trace;
+  std::string long_frame(TraceFrame::DATA_SIZE + 10, 'A');
+  trace.record(TraceDirection::RX, 0, nullptr, long_frame);
+  EXPECT_EQ(trace.at(0).length, TraceFrame::DATA_SIZE);
+  EXPECT_TRUE(trace.at(0).truncated);
+  EXPECT_TRUE(format_trace_frame(trace.at(0)).ends_with("..."));
+}
+
+TEST(WireTraceTest, ClearResets) {
+  WireTrace<2> trace;
+  trace.record(TraceDirection::TX, 0, nullptr, "x");
+  trace.clear();
+  EXPECT_EQ(trace.size(), 0u);
+}
+
+TEST(WireTraceTest, EscapesControlBytes) {
+  EXPECT_EQ(escape_wire_bytes("PWR=01\r:"), "PWR=01\\r:");
+  EXPECT_EQ(escape_wire_bytes(std::string_view("\n\x00\x7F", 3)), "\\n\\x00\\x7F");
+  EXPECT_EQ(escape_wire_bytes("a\\b"), "a\\\\b");
+}
+
+TEST(WireTraceTest, FormatsFrameAsCaptureLine) {
+  WireTrace<2> trace;
+  trace.record(TraceDirection::RX, 1234, find_query_info(QueryType::LAMP_HOURS), "LAMP=1200\r:");
+  trace.record(TraceDirection::TX, 1300, nullptr, "PWR ON\r");
+  EXPECT_EQ(trace.at(0).query, static_cast<uint8_t>(QueryType::LAMP_HOURS));
+  EXPECT_EQ(trace.at(1).query, TRACE_NO_QUERY);
+  EXPECT_EQ(format_trace_frame(trace.at(0)), "1234 RX LAMP=1200\\r:");
+  EXPECT_EQ(format_trace_frame(trace.at(1)), "1300 TX PWR ON\\r");
+}
+
+TEST(WireTraceTest, UnescapeReversesEscape) {
+  std::string bytes("A\\B\r\n\x00\x7F\xFF:", 9);
+  EXPECT_EQ(unescape_wire_bytes(escape_wire_bytes(bytes)), bytes);
+  EXPECT_EQ(unescape_wire_bytes("PWR=01\\r:"), "PWR=01\r:");
+}
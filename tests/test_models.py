@@ -83,3 +83,28 @@ def test_eh_tw7100_model(models_module):
     assert "HDMI2" in model["sources"]
     assert model["features"]["power"] is True
     assert model["features"]["luminance"]
+
+
+def test_unsupported_features_for_full_model(models_module):
+    assert models_module.get_unsupported_features("generic") == []
+
+
+def test_unsupported_features_for_business_model(models_module):
+    unsupported = models_module.get_unsupported_features("eb-u42")
+    assert "luminance" in unsupported
+    assert "gamma" in unsupported
+    assert "brightness" not in unsupported
+
+
+def test_common_unsupported_features_across_models(models_module):
+    assert models_module.get_common_unsupported_features(["eb-u42", "generic"]) == []
+    assert models_module.get_common_unsupported_features(["eb-u42", "eb-u42"]) == (
+        models_module.get_unsupported_features("eb-u42")
+    )
+    assert models_module.get_common_unsupported_features([]) == []
+
+
+def test_unsupported_features_are_optional(models_module):
+    for model_id in models_module.get_model_names():
+        for feature in models_module.get_unsupported_features(model_id):
+            assert feature in models_module.OPTIONAL_FEATURES, f"{model_id}: {feature}"